@@ -10,5 +10,8 @@ public class TDTarget : TargetRules
 		Type = TargetType.Game;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
 		ExtraModuleNames.AddRange( new string[] { "TD" } );
+
+		// Lets push based properties skip comparisons until they're marked dirty.
+		bWithPushModel = true;
 	}
 }
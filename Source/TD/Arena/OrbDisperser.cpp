@@ -3,6 +3,7 @@
 #include "Arena/OrbDisperser.h"
 
 #include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
 #include "Components/BoxComponent.h"
 #include "GameState/TDGameState.h"
 #include "Orb/Orb.h"
@@ -27,6 +28,18 @@ void AOrbDisperser::BeginPlay()
         &AOrbDisperser::OnOverlapped);
 }
 
+void AOrbDisperser::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    UTDWorldRegistry::RegisterInWorld(this);
+}
+
+void AOrbDisperser::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UTDWorldRegistry::UnregisterFromWorld(this);
+    Super::EndPlay(EndPlayReason);
+}
+
 #pragma endregion
 
 #pragma region Dispersing
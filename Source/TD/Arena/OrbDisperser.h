@@ -35,6 +35,16 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief Registers with the UTDWorldRegistry.
+     */
+    virtual void PostInitializeComponents() override;
+
+    /**
+     * @brief Unregisters from the UTDWorldRegistry.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #pragma endregion
 
 #pragma region Dispersing
@@ -2,7 +2,22 @@
 
 #include "TeamPlayerStart.h"
 
+#include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
+
 ETeamIndex ATeamPlayerStart::GetTeam() const
 {
     return Team;
 }
+
+void ATeamPlayerStart::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    UTDWorldRegistry::RegisterInWorld(this);
+}
+
+void ATeamPlayerStart::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UTDWorldRegistry::UnregisterFromWorld(this);
+    Super::EndPlay(EndPlayReason);
+}
@@ -23,6 +23,16 @@ public:
     /* @see ITeamAssignable */
     virtual ETeamIndex GetTeam() const override;
 
+    /**
+     * @brief Registers with the UTDWorldRegistry.
+     */
+    virtual void PostInitializeComponents() override;
+
+    /**
+     * @brief Unregisters from the UTDWorldRegistry.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 protected:
     /**
      * @brief The team this player start belongs to.
@@ -5,6 +5,7 @@
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
 #include "BFPlayerMovement.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 
 static TAutoConsoleVariable<int32> CVarBunnyhop(TEXT("move.Bunnyhopping"), 0,
@@ -24,7 +25,10 @@ void ABFPlayerCharacter::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(ABFPlayerCharacter, IsMovementEnabled)
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(ABFPlayerCharacter, IsMovementEnabled,
+        Params);
 }
 
 bool ABFPlayerCharacter::CanJumpInternal_Implementation() const
@@ -290,6 +294,7 @@ void ABFPlayerCharacter::SetupPlayerInputComponent(
 void ABFPlayerCharacter::SetIsMovementEnabled(bool IsEnabled)
 {
     IsMovementEnabled = IsEnabled;
+    MARK_PROPERTY_DIRTY_FROM_NAME(ABFPlayerCharacter, IsMovementEnabled, this);
 }
 
 void ABFPlayerCharacter::Jump()
@@ -3,6 +3,7 @@
 #include "DebugGameStateHUD.h"
 
 #include "GameConfiguration.h"
+#include "GameModes/RoundStateMachine.h"
 #include "GameState/RoundState.h"
 #include "GameState/TDGameState.h"
 #include "GameState/Components/ScoreState.h"
@@ -25,34 +26,39 @@ void ADebugGameStateHUD::DrawHUD()
         return;
     }
 
+    const float ServerTime = GameState->GetServerWorldTimeSeconds();
+    const URoundState* RoundState = GameState->RoundStateComponent;
     HorizontalOffset = 300.0f;
     X = 50.0f;
     LineHeight = 16.0f;
     AddText(TEXT("Match State"), FText::FromName(GameState->MatchState));
     X = 100.0f;
-    AddBool(TEXT("ShouldMatchTimerTick"),
-        GameState->RoundStateComponent->ShouldMatchTimerTick);
+    AddBool(TEXT("IsMatchTimerRunning"), GameState->MatchTimer.IsRunning);
     LineHeight = 32.0f;
-    AddFloat(TEXT("SecondsUntilMatchEnds"), GameState->SecondsUntilMatchEnds);
+    AddFloat(TEXT("SecondsUntilMatchEnds"),
+        GameState->MatchTimer.GetSeconds(ServerTime));
 
     X = 50.0f;
     LineHeight = 16.0f;
+    const FMatchRoundState& MatchRoundState = RoundState->GetMatchRoundState();
     AddText(TEXT("Round State"),
-        FText::FromName(GameState->RoundStateComponent->RoundState));
+        FText::FromName(RoundState::FromPhase(MatchRoundState.RoundPhase)));
+    AddInt(TEXT("RoundNumber"), MatchRoundState.RoundNumber);
+    AddBool(TEXT("IsInPlay"), MatchRoundState.IsInPlay);
     X = 100.0f;
-    AddBool(TEXT("ShouldStartRoundTimerTick"),
-        GameState->RoundStateComponent->ShouldStartRoundTimerTick);
+    AddBool(TEXT("IsRoundStartTimerRunning"),
+        RoundState->RoundStartTimer.IsRunning);
     AddFloat(TEXT("SecondsUntilRoundStarts"),
-        GameState->RoundStateComponent->SecondsUntilRoundStarts);
-    AddBool(TEXT("ShouldOvertimeTimerTick"),
-        GameState->RoundStateComponent->ShouldOvertimeTimerTick);
+        RoundState->RoundStartTimer.GetSeconds(ServerTime));
+    AddBool(TEXT("IsOvertimeTimerRunning"),
+        RoundState->OvertimeTimer.IsRunning);
     AddFloat(TEXT("OvertimeSecondsPassed"),
-        GameState->RoundStateComponent->OvertimeSecondsPassed);
-    AddBool(TEXT("ShouldEndOfRoundTimerTick"),
-        GameState->RoundStateComponent->ShouldEndOfRoundTimerTick);
+        RoundState->OvertimeTimer.GetSeconds(ServerTime));
+    AddBool(TEXT("IsNextRoundTimerRunning"),
+        RoundState->NextRoundTimer.IsRunning);
     LineHeight = 32.0f;
     AddFloat(TEXT("SecondsUntilNextRoundStarts"),
-        GameState->RoundStateComponent->SecondsUntilNextRoundStarts);
+        RoundState->NextRoundTimer.GetSeconds(ServerTime));
 
     uint8 Index = 0;
     for (uint8 Score : GameState->ScoreStateComponent->TeamScores)
@@ -10,6 +10,38 @@
 
 DEFINE_LOG_CATEGORY(LogTDRSM);
 
+namespace RoundState
+{
+    FName FromPhase(const ERoundPhase Phase)
+    {
+        switch (Phase)
+        {
+        case ERoundPhase::WaitingPreRound:
+            return WaitingPreRound;
+        case ERoundPhase::RoundInProgress:
+            return RoundInProgress;
+        case ERoundPhase::RoundInOvertime:
+            return RoundInOvertime;
+        case ERoundPhase::WaitingPostRound:
+            return WaitingPostRound;
+        default:
+            return NAME_None;
+        }
+    }
+
+    ERoundPhase ToPhase(const FName& State)
+    {
+        for (const ERoundPhase Phase : TEnumRange<ERoundPhase>())
+        {
+            if (FromPhase(Phase) == State)
+            {
+                return Phase;
+            }
+        }
+        return ERoundPhase::None;
+    }
+}
+
 #pragma region Round State
 
 void URoundStateMachine::InitState(ATDGameState* GameState)
@@ -20,49 +52,49 @@ void URoundStateMachine::InitState(ATDGameState* GameState)
     State->StateMachine = this;
 }
 
-FName URoundStateMachine::GetRoundState() const
+ERoundPhase URoundStateMachine::GetRoundPhase() const
 {
-    return RoundState;
+    return RoundPhase;
 }
 
-void URoundStateMachine::SetRoundState(const FName& NewState)
+void URoundStateMachine::SetRoundPhase(const ERoundPhase NewPhase)
 {
-    if (RoundState == NewState)
+    if (RoundPhase == NewPhase)
     {
         return;
     }
 
-    RoundState = NewState;
-    State->SetRoundState(NewState);
-    OnRoundStateSet(NewState);
+    RoundPhase = NewPhase;
+    State->SetRoundPhase(NewPhase);
+    OnRoundPhaseSet(NewPhase);
+    TDGameMode->RequestMatchStateEvaluation();
+}
+
+void URoundStateMachine::SetRoundState(const FName& NewState)
+{
+    SetRoundPhase(RoundState::ToPhase(NewState));
 }
 
-void URoundStateMachine::OnRoundStateSet(const FName& NewState)
+void URoundStateMachine::OnRoundPhaseSet(const ERoundPhase NewPhase)
 {
-    UE_LOG(LogTDGM, Log, TEXT("RoundState set to %s"), *NewState.ToString());
-    if (RoundState == RoundState::WaitingPreRound)
+    UE_LOG(LogTDGM, Log, TEXT("RoundState set to %s"),
+        *RoundState::FromPhase(NewPhase).ToString());
+    switch (NewPhase)
     {
+    case ERoundPhase::WaitingPreRound:
         HandleRoundIsWaitingToStart();
-    }
-    else if (RoundState == RoundState::RoundInProgress)
-    {
-        HandleRoundHasStarted();
-    }
-    else if (RoundState == RoundState::WaitingPostRound)
-    {
+        break;
+    case ERoundPhase::WaitingPostRound:
         HandleRoundHasEnded();
-    }
-    else if (RoundState == RoundState::RoundInOvertime)
-    {
-        HandleOvertimeHasStarted();
-    }
-    else
-    {
+        break;
+    case ERoundPhase::RoundInProgress:
+    case ERoundPhase::RoundInOvertime:
+        break;
+    default:
         UE_LOG(LogTDGM, Warning,
-            TEXT(
-                "URoundStateMachine::OnRoundStateSet received unknown state: %s"
-            ),
-            *NewState.ToString())
+            TEXT("URoundStateMachine::OnRoundPhaseSet received unknown phase: "
+                "%d"), static_cast<uint8>(NewPhase));
+        break;
     }
 }
 
@@ -75,38 +107,46 @@ uint8 URoundStateMachine::GetRoundStartDelayInSeconds() const
 
 void URoundStateMachine::HandleRoundIsWaitingToStart()
 {
-    RoundIsWaitingToStartEvent.Broadcast();
+    HasRoundStartDelayPassed = RoundStartDelayInSeconds == 0;
+    if (!HasRoundStartDelayPassed)
+    {
+        GetWorld()->GetTimerManager().SetTimer(RoundStartDelayTimerHandle, this,
+            &URoundStateMachine::HandleRoundStartDelayPassed,
+            RoundStartDelayInSeconds, false);
+    }
 }
 
 bool URoundStateMachine::ReadyToStartRound() const
 {
-    return RoundState == RoundState::WaitingPreRound &&
-           !State->IsThereRoundStartDelayLeft();
+    return RoundPhase == ERoundPhase::WaitingPreRound &&
+           HasRoundStartDelayPassed &&
+           TDGameMode->IsLevelStreamingReady();
+}
+
+void URoundStateMachine::HandleRoundStartDelayPassed()
+{
+    HasRoundStartDelayPassed = true;
+    TDGameMode->RequestMatchStateEvaluation();
 }
 
 void URoundStateMachine::StartRound()
 {
-    if (RoundState == RoundState::RoundInProgress)
+    if (RoundPhase == ERoundPhase::RoundInProgress)
     {
         return;
     }
-    SetRoundState(RoundState::RoundInProgress);
+    SetRoundPhase(ERoundPhase::RoundInProgress);
 }
 
 #pragma endregion Starting Round
 
 #pragma region Round In Progress
 
-void URoundStateMachine::HandleRoundHasStarted()
-{
-    RoundHasStartedEvent.Broadcast();
-}
-
 bool URoundStateMachine::ReadyToEndRound() const
 {
     UTeamState* TeamState = TDGameState->GetTeamStateComponent();
     return TDGameMode->GetMatchState() == MatchState::InProgress &&
-           RoundState == RoundState::RoundInProgress &&
+           RoundPhase == ERoundPhase::RoundInProgress &&
            TeamState->HasAPlayerBeenEliminated();
 }
 
@@ -116,28 +156,28 @@ bool URoundStateMachine::ReadyToEndRound() const
 
 void URoundStateMachine::EndRound()
 {
-    if (RoundState == RoundState::WaitingPostRound)
+    if (RoundPhase == ERoundPhase::WaitingPostRound)
     {
         return;
     }
-    SetRoundState(RoundState::WaitingPostRound);
+    SetRoundPhase(ERoundPhase::WaitingPostRound);
 }
 
 bool URoundStateMachine::ReadyToStartNextRound() const
 {
     return TDGameMode->GetMatchState() == MatchState::InProgress &&
-           RoundState == RoundState::WaitingPostRound &&
-           !State->IsThereEndOfRoundDelayLeft();
+           RoundPhase == ERoundPhase::WaitingPostRound &&
+           HasEndOfRoundDelayPassed;
 }
 
 void URoundStateMachine::StartNextRound()
 {
-    if (RoundState == RoundState::WaitingPreRound)
+    if (RoundPhase == ERoundPhase::WaitingPreRound)
     {
         return;
     }
 
-    SetRoundState(RoundState::WaitingPreRound);
+    SetRoundPhase(ERoundPhase::WaitingPreRound);
 }
 
 #pragma endregion Ending Round
@@ -151,7 +191,19 @@ uint8 URoundStateMachine::GetEndOfRoundDelayInSeconds() const
 
 void URoundStateMachine::HandleRoundHasEnded()
 {
-    RoundHasEndedEvent.Broadcast();
+    HasEndOfRoundDelayPassed = EndOfRoundDelayInSeconds == 0;
+    if (!HasEndOfRoundDelayPassed)
+    {
+        GetWorld()->GetTimerManager().SetTimer(EndOfRoundDelayTimerHandle, this,
+            &URoundStateMachine::HandleEndOfRoundDelayPassed,
+            EndOfRoundDelayInSeconds, false);
+    }
+}
+
+void URoundStateMachine::HandleEndOfRoundDelayPassed()
+{
+    HasEndOfRoundDelayPassed = true;
+    TDGameMode->RequestMatchStateEvaluation();
 }
 
 #pragma endregion
@@ -170,15 +222,16 @@ bool URoundStateMachine::ReadyToStartOvertime() const
         return false;
     }
 
-    if (RoundState == RoundState::WaitingPreRound)
+    if (RoundPhase == ERoundPhase::WaitingPreRound)
     {
-        return !TDGameState->IsThereMatchTimeLeft() &&
-               !State->IsThereRoundStartDelayLeft();
+        return !TDGameMode->IsThereMatchTimeLeft() &&
+               HasRoundStartDelayPassed &&
+               TDGameMode->IsLevelStreamingReady();
     }
 
-    if (RoundState == RoundState::RoundInProgress)
+    if (RoundPhase == ERoundPhase::RoundInProgress)
     {
-        return !TDGameState->IsThereMatchTimeLeft();
+        return !TDGameMode->IsThereMatchTimeLeft();
     }
 
     return false;
@@ -186,31 +239,44 @@ bool URoundStateMachine::ReadyToStartOvertime() const
 
 void URoundStateMachine::InterruptRoundWithOvertime()
 {
-    if (RoundState == RoundState::WaitingPreRound)
+    if (RoundPhase == ERoundPhase::WaitingPreRound)
     {
         return;
     }
 
-    SetRoundState(RoundState::WaitingPreRound);
+    SetRoundPhase(ERoundPhase::WaitingPreRound);
 }
 
 void URoundStateMachine::StartOvertime()
 {
-    if (RoundState == RoundState::RoundInOvertime)
+    if (RoundPhase == ERoundPhase::RoundInOvertime)
     {
         return;
     }
 
-    SetRoundState(RoundState::RoundInOvertime);
+    SetRoundPhase(ERoundPhase::RoundInOvertime);
 }
 
-void URoundStateMachine::HandleOvertimeHasStarted()
+void URoundStateMachine::HandleMatchHasEnded()
 {
-    OvertimeHasStartedEvent.Broadcast();
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    TimerManager.ClearTimer(RoundStartDelayTimerHandle);
+    TimerManager.ClearTimer(EndOfRoundDelayTimerHandle);
 }
 
-void URoundStateMachine::HandleMatchHasEnded()
+void URoundStateMachine::HandleMatchIsWaitingToStart()
 {
+    FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+    TimerManager.ClearTimer(RoundStartDelayTimerHandle);
+    TimerManager.ClearTimer(EndOfRoundDelayTimerHandle);
+    if (RoundPhase == ERoundPhase::None)
+    {
+        return;
+    }
+
+    // Not through SetRoundPhase() since None has no callbacks.
+    RoundPhase = ERoundPhase::None;
+    State->SetRoundPhase(ERoundPhase::None);
 }
 
 #pragma endregion
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+
+#include "TDTypes.h"
 #include "Components/ActorComponent.h"
 #include "RoundStateMachine.generated.h"
 
@@ -38,6 +40,16 @@ namespace RoundState
      * @brief The round ended and is waiting for the next one to start.
      */
     extern TD_API const FName WaitingPostRound;
+
+    /**
+     * @brief Gets the round state name of the phase, or None.
+     */
+    TD_API FName FromPhase(const ERoundPhase Phase);
+
+    /**
+     * @brief Gets the phase of the round state name, or None.
+     */
+    TD_API ERoundPhase ToPhase(const FName& State);
 }
 
 /**
@@ -72,63 +84,38 @@ private:
 
 public:
     /**
-     * @brief Gets the current round state.
+     * @brief Gets the current round phase.
      */
-    FName GetRoundState() const;
+    ERoundPhase GetRoundPhase() const;
 
     /**
-     * @brief Sets the round state and calls appropriate callbacks.
-     * @param NewState The new round state to switch to.
+     * @brief Sets the round phase and calls appropriate callbacks. Requests
+     * the game mode to re-evaluate the match state since a transition may
+     * enable another one.
+     * @param NewPhase The new round phase to switch to.
+     */
+    void SetRoundPhase(const ERoundPhase NewPhase);
+
+    /**
+     * @brief Sets the round state by name. For debugging from the console.
+     * @param NewState The name of the new round state to switch to.
      */
     UFUNCTION(Exec)
     void SetRoundState(const FName& NewState);
 
 private:
     /**
-     * @brief The current round state. Usually one of WaitingPreRound,
-     * RoundInProgress, Overtime, or WaitingPostRound, but is None until the
-     * match starts since it's Transient.
+     * @brief The current round phase. Usually one of WaitingPreRound,
+     * RoundInProgress, RoundInOvertime, or WaitingPostRound, but is None until
+     * the match starts since it's Transient.
      */
     UPROPERTY(Transient, VisibleInstanceOnly)
-    FName RoundState;
+    ERoundPhase RoundPhase = ERoundPhase::None;
 
     /**
-     * @brief Calls the appropriate callbacks for the new round state.
+     * @brief Calls the appropriate callbacks for the new round phase.
      */
-    void OnRoundStateSet(const FName& NewState);
-
-#pragma region State Change Events
-
-    DECLARE_EVENT(URoundStateMachine, FRoundIsWaitingToStartEvent);
-
-    DECLARE_EVENT(URoundStateMachine, FRoundHasStartedEvent);
-
-    DECLARE_EVENT(URoundStateMachine, FRoundHasEndedEvent);
-
-    DECLARE_EVENT(URoundStateMachine, FOvertimeHasStartedEvent);
-
-public:
-    /**
-     * @brief Event for when round state is set to WaitingPreRound.
-     */
-    FRoundIsWaitingToStartEvent RoundIsWaitingToStartEvent;
-
-    /**
-     * @brief Event for when round state is set to RoundInProgress.
-     */
-    FRoundHasStartedEvent RoundHasStartedEvent;
-
-    /**
-     * @brief Event for when round state is set to WaitingPostRound.
-     */
-    FRoundHasEndedEvent RoundHasEndedEvent;
-
-    /**
-     * @brief Event for when round state is set to RoundInOvertime.
-     */
-    FOvertimeHasStartedEvent OvertimeHasStartedEvent;
-
-#pragma endregion
+    void OnRoundPhaseSet(const ERoundPhase NewPhase);
 
 #pragma region Starting Round
 
@@ -156,6 +143,21 @@ private:
      */
     bool ReadyToStartRound() const;
 
+    /**
+     * @brief Timer for the delay before starting a round.
+     */
+    FTimerHandle RoundStartDelayTimerHandle;
+
+    /**
+     * @brief Whether the round start delay has passed.
+     */
+    bool HasRoundStartDelayPassed = false;
+
+    /**
+     * @brief Callback for when the round start delay timer expires.
+     */
+    void HandleRoundStartDelayPassed();
+
     /**
      * @brief Transitions round state from None to WaitingPreRound.
      */
@@ -166,11 +168,6 @@ private:
 #pragma region Round In Progress
 
 private:
-    /**
-     * @brief Callback for when round state has been set to RoundInProgress.
-     */
-    void HandleRoundHasStarted();
-
     /**
      * @brief Check for whether the round should end.
      */
@@ -219,6 +216,21 @@ private:
      */
     void HandleRoundHasEnded();
 
+    /**
+     * @brief Timer for the delay before starting the next round.
+     */
+    FTimerHandle EndOfRoundDelayTimerHandle;
+
+    /**
+     * @brief Whether the end of round delay has passed.
+     */
+    bool HasEndOfRoundDelayPassed = false;
+
+    /**
+     * @brief Callback for when the end of round delay timer expires.
+     */
+    void HandleEndOfRoundDelayPassed();
+
 #pragma endregion
 
 #pragma region Overtime
@@ -239,11 +251,6 @@ private:
      */
     void StartOvertime();
 
-    /**
-     * @brief Callback for when round state has been set to RoundInOvertime.
-     */
-    void HandleOvertimeHasStarted();
-
     /**
      * There is no ReadyToEndOvertime() method because Overtime is the final
      * state of the Round State Machine. There are no transitions outside of
@@ -257,6 +264,12 @@ private:
      */
     void HandleMatchHasEnded();
 
+    /**
+     * @brief Clears the round phase so that the next match starts from
+     * WaitingPreRound, e.g. when the match is restarted in place.
+     */
+    void HandleMatchIsWaitingToStart();
+
 #pragma endregion
 
 #pragma endregion
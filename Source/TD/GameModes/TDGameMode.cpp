@@ -2,8 +2,9 @@
 
 #include "TDGameMode.h"
 
-#include "EngineUtils.h"
 #include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
+#include "Engine/LevelStreaming.h"
 #include "GameFramework/GameSession.h"
 #include "GameState/TDGameState.h"
 #include "GameState/Components/OrbState.h"
@@ -34,6 +35,9 @@ ATDGameMode::ATDGameMode()
 
     bStartPlayersAsSpectators = true;
 
+    // Match and round transitions are driven by RequestMatchStateEvaluation().
+    PrimaryActorTick.bCanEverTick = false;
+
     RSM = CreateDefaultSubobject<URoundStateMachine>(TEXT("RSM"));
     check(RSM != nullptr);
 }
@@ -79,13 +83,80 @@ void ATDGameMode::InitGameState()
 void ATDGameMode::BeginPlay()
 {
     Super::BeginPlay();
-    RSM->RoundIsWaitingToStartEvent.AddUObject(this,
-        &ATDGameMode::HandleRoundIsWaitingToStart);
-    RSM->RoundHasStartedEvent.AddUObject(this,
-        &ATDGameMode::HandleRoundHasStarted);
-    RSM->RoundHasEndedEvent.AddUObject(this, &ATDGameMode::HandleRoundHasEnded);
-    RSM->OvertimeHasStartedEvent.AddUObject(this,
-        &ATDGameMode::HandleOvertimeHasStarted);
+    // After the game state's and its components' subscribers, as when the
+    // round state machine called back once the round state had been set.
+    TDGameState->GetEventBus().Subscribe<FTDPhaseChangedEvent, ATDGameMode,
+        &ATDGameMode::HandlePhaseChanged>(this, 1);
+    LevelAddedToWorldHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(
+        this, &ATDGameMode::HandleLevelAddedToWorld);
+}
+
+void ATDGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedToWorldHandle);
+    if (TDGameState != nullptr)
+    {
+        TDGameState->GetEventBus().UnsubscribeAll(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+#pragma endregion
+
+#pragma region Level Streaming
+
+bool ATDGameMode::IsLevelStreamingReady()
+{
+    if (IsLevelStreamingPending())
+    {
+        if (LevelStreamingGateStartSeconds == 0.0)
+        {
+            LevelStreamingGateStartSeconds = FPlatformTime::Seconds();
+        }
+        return false;
+    }
+
+    if (LevelStreamingGateStartSeconds != 0.0)
+    {
+        LastLevelStreamingGateSeconds = FPlatformTime::Seconds() -
+                                        LevelStreamingGateStartSeconds;
+        LevelStreamingGateStartSeconds = 0.0;
+        UE_LOG(LogTDGM, Log,
+            TEXT("Start was waiting on level streaming for %.1f ms"),
+            LastLevelStreamingGateSeconds * 1000.0f);
+    }
+    return true;
+}
+
+bool ATDGameMode::IsLevelStreamingPending() const
+{
+    const UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        return false;
+    }
+
+    if (World->IsVisibilityRequestPending())
+    {
+        return true;
+    }
+    for (const ULevelStreaming* LevelStreaming : World->GetStreamingLevels())
+    {
+        if (LevelStreaming != nullptr && LevelStreaming->ShouldBeVisible() &&
+            !LevelStreaming->IsLevelVisible())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ATDGameMode::HandleLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+    if (World == GetWorld() && LevelStreamingGateStartSeconds != 0.0)
+    {
+        RequestMatchStateEvaluation();
+    }
 }
 
 #pragma endregion
@@ -133,14 +204,55 @@ bool ATDGameMode::ShouldSpawnAtStartSpot(AController* Player)
     return false;
 }
 
+void ATDGameMode::PostLogin(APlayerController* NewPlayer)
+{
+    Super::PostLogin(NewPlayer);
+    ATDController* TDController = Cast<ATDController>(NewPlayer);
+    if (IsMatchInProgress() && TDController != nullptr &&
+        !TDController->IsLocalController())
+    {
+        TDController->Client_ReceiveJoinSnapshot(
+            TDGameState->MakeJoinSnapshot());
+    }
+    RequestMatchStateEvaluation();
+}
+
+void ATDGameMode::Logout(AController* Exiting)
+{
+    Super::Logout(Exiting);
+    if (TDGameState != nullptr && Exiting != nullptr)
+    {
+        UTeamState* TeamState = TDGameState->GetTeamStateComponent();
+        TeamState->RemovePlayer(Exiting->GetPlayerState<ATDPlayerState>());
+    }
+    RequestMatchStateEvaluation();
+}
+
 #pragma endregion
 
 #pragma region Match State
 
-void ATDGameMode::Tick(float DeltaSeconds)
+void ATDGameMode::RequestMatchStateEvaluation()
+{
+    if (IsMatchStateEvaluationPending)
+    {
+        return;
+    }
+
+    IsMatchStateEvaluationPending = true;
+    GetWorldTimerManager().SetTimerForNextTick(this,
+        &ATDGameMode::EvaluateMatchState);
+}
+
+void ATDGameMode::OnMatchStateSet()
+{
+    Super::OnMatchStateSet();
+    RequestMatchStateEvaluation();
+}
+
+void ATDGameMode::EvaluateMatchState()
 {
-    // Go to Actor tick, skip GameMode tick
-    Super::Super::Tick(DeltaSeconds);
+    IsMatchStateEvaluationPending = false;
 
     if (GetMatchState() == MatchState::WaitingToStart)
     {
@@ -152,19 +264,21 @@ void ATDGameMode::Tick(float DeltaSeconds)
 
     if (GetMatchState() == MatchState::InProgress)
     {
-        if (RSM->GetRoundState() == RoundState::WaitingPreRound)
+        if (RSM->GetRoundPhase() == ERoundPhase::WaitingPreRound)
         {
             if (RSM->ReadyToStartOvertime())
             {
+                FinishPreRoundReset();
                 RSM->StartOvertime();
             }
             else if (RSM->ReadyToStartRound())
             {
+                FinishPreRoundReset();
                 RSM->StartRound();
             }
         }
 
-        if (RSM->GetRoundState() == RoundState::RoundInProgress)
+        if (RSM->GetRoundPhase() == ERoundPhase::RoundInProgress)
         {
             if (RSM->ReadyToEndRound())
             {
@@ -180,7 +294,7 @@ void ATDGameMode::Tick(float DeltaSeconds)
             }
         }
 
-        if (RSM->GetRoundState() == RoundState::WaitingPostRound)
+        if (RSM->GetRoundPhase() == ERoundPhase::WaitingPostRound)
         {
             if (RSM->ReadyToStartNextRound())
             {
@@ -188,7 +302,7 @@ void ATDGameMode::Tick(float DeltaSeconds)
             }
         }
 
-        if (RSM->GetRoundState() == RoundState::RoundInOvertime)
+        if (RSM->GetRoundPhase() == ERoundPhase::RoundInOvertime)
         {
             if (ReadyToEndOvertime())
             {
@@ -201,19 +315,33 @@ void ATDGameMode::Tick(float DeltaSeconds)
     {
         if (ReadyToRestartMatch())
         {
-            RestartGame();
+            RestartMatch();
         }
     }
 }
 
 #pragma region Starting Match
 
+void ATDGameMode::HandleMatchIsWaitingToStart()
+{
+    Super::HandleMatchIsWaitingToStart();
+    RSM->HandleMatchIsWaitingToStart();
+}
+
 bool ATDGameMode::ReadyToStartMatch_Implementation()
 {
     UTeamState* TeamState = TDGameState->GetTeamStateComponent();
-    return ShouldStartImmediately ||
-           TeamState->DoesEachActiveTeamHaveAtLeastOnePlayer() &&
-           Super::ReadyToStartMatch_Implementation();
+    // Streaming is checked last so that only the time it holds back an
+    // otherwise ready start is measured.
+    return (ShouldStartImmediately ||
+            TeamState->DoesEachActiveTeamHaveAtLeastOnePlayer() &&
+            Super::ReadyToStartMatch_Implementation()) &&
+           IsLevelStreamingReady();
+}
+
+void ATDGameMode::HandleStartMatchDelayPassed()
+{
+    RequestMatchStateEvaluation();
 }
 
 #pragma endregion
@@ -225,6 +353,17 @@ uint16 ATDGameMode::GetMatchLengthInSeconds() const
     return MatchLengthInSeconds;
 }
 
+bool ATDGameMode::IsThereMatchTimeLeft() const
+{
+    return !HasMatchTimeRunOut;
+}
+
+void ATDGameMode::HandleMatchTimeRunOut()
+{
+    HasMatchTimeRunOut = true;
+    RequestMatchStateEvaluation();
+}
+
 /**
  * Removes unused features, but most importantly, players are no longer spawned
  * as soon as the match starts. This should be deferred to WaitingPreRound.
@@ -232,71 +371,218 @@ uint16 ATDGameMode::GetMatchLengthInSeconds() const
 void ATDGameMode::HandleMatchHasStarted()
 {
     GameSession->HandleMatchHasStarted();
-    GEngine->BlockTillLevelStreamingCompleted(GetWorld());
     GetWorldSettings()->NotifyBeginPlay();
     GetWorldSettings()->NotifyMatchStarted();
-    RSM->SetRoundState(RoundState::WaitingPreRound);
+
+    // The match timer only runs during RoundInProgress, so start it paused.
+    HasMatchTimeRunOut = MatchLengthInSeconds == 0;
+    if (!HasMatchTimeRunOut)
+    {
+        GetWorldTimerManager().SetTimer(MatchTimerHandle, this,
+            &ATDGameMode::HandleMatchTimeRunOut, MatchLengthInSeconds, false);
+        GetWorldTimerManager().PauseTimer(MatchTimerHandle);
+    }
+    RSM->SetRoundPhase(ERoundPhase::WaitingPreRound);
 }
 
 #pragma region Round State
 
+void ATDGameMode::HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
+{
+    if (Event.OldRoundPhase == Event.RoundPhase)
+    {
+        return;
+    }
+
+    switch (Event.RoundPhase)
+    {
+    case ERoundPhase::WaitingPreRound:
+        HandleRoundIsWaitingToStart();
+        break;
+    case ERoundPhase::RoundInProgress:
+        HandleRoundHasStarted();
+        break;
+    case ERoundPhase::WaitingPostRound:
+        HandleRoundHasEnded();
+        break;
+    case ERoundPhase::RoundInOvertime:
+        HandleOvertimeHasStarted();
+        break;
+    default:
+        break;
+    }
+}
+
 void ATDGameMode::HandleRoundIsWaitingToStart()
 {
-    SpawnActivePlayers();
     DisablePlayerMovement();
+    QueuePreRoundReset();
 }
 
-void ATDGameMode::SpawnActivePlayers()
+void ATDGameMode::QueuePreRoundReset()
 {
+    PreRoundOrbQueue.Reset();
+    PreRoundPlayerQueue.Reset();
+
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
+    {
+        LogInvalidPointer("ATDGameMode", "QueuePreRoundReset", "Registry");
+    }
+    else
+    {
+        for (AOrb* Orb : Registry->GetOrbs())
+        {
+            PreRoundOrbQueue.Emplace(Orb);
+        }
+    }
+
     for (FConstPlayerControllerIterator Iterator = GetWorld()->
              GetPlayerControllerIterator(); Iterator; ++Iterator)
     {
         ATDController* TDController = Cast<ATDController>(Iterator->Get());
-        if (TDController == nullptr)
+        if (TDController != nullptr)
         {
-            continue;
+            PreRoundPlayerQueue.Emplace(TDController);
         }
-        ATDPlayerState* TDPlayerState = TDController->GetPlayerState<
-            ATDPlayerState>();
-        if (TDPlayerState == nullptr)
+    }
+
+    ProcessPreRoundReset();
+}
+
+void ATDGameMode::ProcessPreRoundReset()
+{
+    const double EndSeconds = FPlatformTime::Seconds() +
+                              PreRoundResetBudgetInMilliseconds / 1000.0;
+    while (ProcessNextPreRoundReset())
+    {
+        if (FPlatformTime::Seconds() >= EndSeconds)
         {
-            continue;
+            PreRoundResetTimerHandle = GetWorldTimerManager().
+                SetTimerForNextTick(this, &ATDGameMode::ProcessPreRoundReset);
+            return;
         }
+    }
+}
 
-        if (IsActiveTeam(TDPlayerState->GetTeam()) &&
-            PlayerCanRestart(TDController))
+void ATDGameMode::FinishPreRoundReset()
+{
+    GetWorldTimerManager().ClearTimer(PreRoundResetTimerHandle);
+    while (ProcessNextPreRoundReset())
+    {
+    }
+}
+
+bool ATDGameMode::ProcessNextPreRoundReset()
+{
+    if (PreRoundOrbQueue.Num() > 0)
+    {
+        AOrb* Orb = PreRoundOrbQueue.Pop(false).Get();
+        if (IsValid(Orb) && !Orb->IsActorBeingDestroyed())
         {
-            RestartPlayer(TDController);
-            TDPlayerState->ResetRoundState();
+            Orb->Destroy();
+        }
+        return true;
+    }
+
+    if (PreRoundPlayerQueue.Num() > 0)
+    {
+        ATDController* TDController = PreRoundPlayerQueue.Pop(false).Get();
+        if (TDController != nullptr)
+        {
+            SpawnActivePlayer(TDController);
         }
+        return true;
     }
+
+    return false;
+}
+
+void ATDGameMode::SpawnActivePlayer(ATDController* Player)
+{
+    ATDPlayerState* TDPlayerState = Player->GetPlayerState<ATDPlayerState>();
+    if (TDPlayerState == nullptr || !IsActiveTeam(TDPlayerState->GetTeam()))
+    {
+        return;
+    }
+
+    ATDCharacter* Character = Player->GetPawn<ATDCharacter>();
+    if (Character != nullptr)
+    {
+        ReactivatePlayer(Player, Character);
+    }
+    else if (PlayerCanRestart(Player))
+    {
+        RestartPlayer(Player);
+        Character = Player->GetPawn<ATDCharacter>();
+    }
+    else
+    {
+        return;
+    }
+
+    TDPlayerState->ResetRoundState();
+    if (Character != nullptr)
+    {
+        Character->SetIsMovementEnabled(false);
+    }
+}
+
+void ATDGameMode::ReactivatePlayer(ATDController* Player,
+    ATDCharacter* Character)
+{
+    AActor* StartSpot = ChoosePlayerStart(Player);
+    if (StartSpot == nullptr)
+    {
+        LogInvalidPointer("ATDGameMode", "ReactivatePlayer", "StartSpot");
+        return;
+    }
+
+    const FRotator Rotation(0.0f, StartSpot->GetActorRotation().Yaw, 0.0f);
+    Character->Reactivate(StartSpot->GetActorLocation(), Rotation);
+    Player->SetControlRotation(Rotation);
+    Player->ClientSetRotation(Rotation, true);
 }
 
 void ATDGameMode::DisablePlayerMovement() const
 {
-    for (TActorIterator<ATDCharacter> It(GetWorld()); It; ++It)
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
+    {
+        LogInvalidPointer("ATDGameMode", "DisablePlayerMovement", "Registry");
+        return;
+    }
+
+    for (ATDCharacter* Player : Registry->GetCharacters())
     {
-        ATDCharacter* Player = *It;
         Player->SetIsMovementEnabled(false);
     }
 }
 
 void ATDGameMode::HandleRoundHasStarted()
 {
+    GetWorldTimerManager().UnPauseTimer(MatchTimerHandle);
     HandlePlayHasStarted();
 }
 
 void ATDGameMode::EnablePlayerMovement() const
 {
-    for (TActorIterator<ATDCharacter> It(GetWorld()); It; ++It)
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
+    {
+        LogInvalidPointer("ATDGameMode", "EnablePlayerMovement", "Registry");
+        return;
+    }
+
+    for (ATDCharacter* Player : Registry->GetCharacters())
     {
-        ATDCharacter* Player = *It;
         Player->SetIsMovementEnabled(true);
     }
 }
 
 void ATDGameMode::HandleRoundHasEnded()
 {
+    GetWorldTimerManager().PauseTimer(MatchTimerHandle);
 }
 
 void ATDGameMode::HandleOvertimeHasStarted()
@@ -319,7 +605,7 @@ bool ATDGameMode::ReadyToEndMatch_Implementation()
 {
     UScoreState* ScoreState = TDGameState->GetScoreStateComponent();
     return MatchState == MatchState::InProgress &&
-           !TDGameState->IsThereMatchTimeLeft() &&
+           !IsThereMatchTimeLeft() &&
            ScoreState->IsATeamStrictlyWinning();
 }
 
@@ -327,14 +613,14 @@ bool ATDGameMode::ReadyToEndOvertime() const
 {
     UTeamState* TeamState = TDGameState->GetTeamStateComponent();
     return MatchState == MatchState::InProgress &&
-           RSM->RoundState == RoundState::RoundInOvertime &&
+           RSM->RoundPhase == ERoundPhase::RoundInOvertime &&
            TeamState->AreThereFewerThanTwoTeamsWithPlayersLeft();
 }
 
 void ATDGameMode::EndOvertime()
 {
     if (MatchState != MatchState::InProgress ||
-        RSM->RoundState != RoundState::RoundInOvertime)
+        RSM->RoundPhase != ERoundPhase::RoundInOvertime)
     {
         return;
     }
@@ -361,6 +647,15 @@ void ATDGameMode::HandleMatchHasEnded()
     Super::HandleMatchHasEnded();
     DisablePlayerMovement();
     RSM->HandleMatchHasEnded();
+
+    GetWorldTimerManager().ClearTimer(MatchTimerHandle);
+    HasMatchRestartDelayPassed = MatchRestartDelayInSeconds == 0;
+    if (!HasMatchRestartDelayPassed)
+    {
+        GetWorldTimerManager().SetTimer(MatchRestartDelayTimerHandle, this,
+            &ATDGameMode::HandleMatchRestartDelayPassed,
+            MatchRestartDelayInSeconds, false);
+    }
 }
 
 void ATDGameMode::HandleLeavingMap()
@@ -371,7 +666,52 @@ void ATDGameMode::HandleLeavingMap()
 bool ATDGameMode::ReadyToRestartMatch() const
 {
     return MatchState == MatchState::WaitingPostMatch &&
-           !TDGameState->IsThereMatchRestartDelayLeft();
+           HasMatchRestartDelayPassed;
+}
+
+void ATDGameMode::HandleMatchRestartDelayPassed()
+{
+    HasMatchRestartDelayPassed = true;
+    RequestMatchStateEvaluation();
+}
+
+void ATDGameMode::RestartMatch()
+{
+    UE_LOG(LogTDGM, Log, TEXT("Restarting match in place"));
+    GetWorldTimerManager().ClearTimer(MatchRestartDelayTimerHandle);
+    HasMatchRestartDelayPassed = false;
+    ResetPlayers();
+    SetMatchState(MatchState::WaitingToStart);
+}
+
+void ATDGameMode::ResetPlayers()
+{
+    for (FConstPlayerControllerIterator Iterator = GetWorld()->
+             GetPlayerControllerIterator(); Iterator; ++Iterator)
+    {
+        APlayerController* PlayerController = Iterator->Get();
+        if (PlayerController == nullptr)
+        {
+            continue;
+        }
+
+        // Reset() unpossesses the pawn and puts the player back into
+        // spectating, like when they first joined.
+        APawn* const Pawn = PlayerController->GetPawn();
+        PlayerController->Reset();
+        PlayerController->ClientReset();
+        if (Pawn != nullptr)
+        {
+            Pawn->Destroy();
+        }
+
+        ATDPlayerState* TDPlayerState = PlayerController->GetPlayerState<
+            ATDPlayerState>();
+        if (TDPlayerState != nullptr)
+        {
+            TDPlayerState->ResetRoundState();
+        }
+    }
 }
 
 #pragma endregion
@@ -422,6 +762,7 @@ void ATDGameMode::EliminatePlayer(ATDCharacter* Player)
 
     Player->Eliminate();
     TDController->Client_NotifyEliminated();
+    RequestMatchStateEvaluation();
 }
 
 #pragma endregion
@@ -431,7 +772,7 @@ void ATDGameMode::EliminatePlayer(ATDCharacter* Player)
 #pragma region Player Requests
 
 void ATDGameMode::SwitchPlayerToTeam(ATDController* Player,
-    const ETeamIndex Team) const
+    const ETeamIndex Team)
 {
     if (Player == nullptr || Player->GetPlayerState<ATDPlayerState>() ==
         nullptr)
@@ -452,6 +793,7 @@ void ATDGameMode::SwitchPlayerToTeam(ATDController* Player,
     TeamState->SwitchPlayerToTeam(Player->GetPlayerState<ATDPlayerState>(),
         Team);
     TDGameState->SetPlayerRequestResult(EPlayerRequestResult::Success);
+    RequestMatchStateEvaluation();
 
     static const UEnum* Enum = StaticEnum<ETeamIndex>();
     UE_LOG(LogTDGM, Log, TEXT("Switching player %s to team %s"),
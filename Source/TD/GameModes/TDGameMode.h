@@ -6,6 +6,7 @@
 #include "LobbySystem/LSGameMode.h"
 #include "TDGameMode.generated.h"
 
+struct FTDPhaseChangedEvent;
 struct FTeam;
 class URoundStateMachine;
 class ATDGameState;
@@ -58,10 +59,12 @@ protected:
     TSubclassOf<AGameRules> GameRulesClass = nullptr;
 
     /**
-     * @brief Binds to round state events.
+     * @brief Subscribes to phase changes and binds to level streaming events.
      */
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
     /**
      * @brief The game's state.
@@ -82,6 +85,46 @@ private:
 
 #pragma endregion
 
+#pragma region Level Streaming
+
+public:
+    /**
+     * @brief Check for whether every streaming level that should be visible
+     * has been added to the world. Starting the match and each round waits on
+     * this instead of blocking the game thread until streaming completes.
+     * Also measures how long the start was held back by streaming.
+     */
+    bool IsLevelStreamingReady();
+
+private:
+    /**
+     * @brief Check for whether any streaming level that should be visible
+     * isn't yet.
+     */
+    bool IsLevelStreamingPending() const;
+
+    /**
+     * @brief Re-evaluates the match state when a streaming level is added to
+     * the world while the start is waiting on streaming.
+     */
+    void HandleLevelAddedToWorld(ULevel* Level, UWorld* World);
+
+    FDelegateHandle LevelAddedToWorldHandle;
+
+    /**
+     * @brief The platform time that streaming started holding back the start,
+     * or 0 if it isn't.
+     */
+    double LevelStreamingGateStartSeconds = 0.0;
+
+    /**
+     * @brief How long the last start was held back by streaming.
+     */
+    UPROPERTY(VisibleInstanceOnly, Category = "Level Streaming")
+    float LastLevelStreamingGateSeconds = 0.0f;
+
+#pragma endregion
+
 #pragma region Player Connection
 
 public:
@@ -110,19 +153,57 @@ public:
      */
     virtual bool ShouldSpawnAtStartSpot(AController* Player) override;
 
+    /**
+     * @brief Sends the join snapshot to players joining a match in progress,
+     * then re-evaluates the match state since a player joined.
+     */
+    virtual void PostLogin(APlayerController* NewPlayer) override;
+
+    /**
+     * @brief Re-evaluates the match state since a player left.
+     */
+    virtual void Logout(AController* Exiting) override;
+
 #pragma endregion
 
 #pragma region Match State
 
 public:
+    /**
+     * @brief Schedules a check for whether the match and round states should
+     * change states on the next tick. Should be called whenever something that
+     * a Ready* check depends on changes (a timer expiring, a player being
+     * eliminated, a player switching teams, etc.). Multiple requests within
+     * the same frame are coalesced into a single check.
+     */
+    void RequestMatchStateEvaluation();
+
+protected:
+    /**
+     * @brief Requests a match state evaluation after each match state change.
+     */
+    virtual void OnMatchStateSet() override;
+
+private:
     /**
      * @brief Checks if the match and round states should change states.
      */
-    virtual void Tick(float DeltaSeconds) override;
+    void EvaluateMatchState();
+
+    /**
+     * @brief Whether a match state evaluation is scheduled for the next tick.
+     */
+    bool IsMatchStateEvaluationPending = false;
 
 #pragma region Starting Match
 
 protected:
+    /**
+     * @brief Callback for when match state has been set to WaitingToStart,
+     * both when the map is loaded and when the match is restarted in place.
+     */
+    virtual void HandleMatchIsWaitingToStart() override;
+
     /**
      * @brief Check for whether the match should start.
      */
@@ -131,6 +212,11 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Starting Match")
     bool ShouldStartImmediately = false;
 
+    /**
+     * @brief Re-evaluates the match state once the start match delay passes.
+     */
+    virtual void HandleStartMatchDelayPassed() override;
+
 #pragma endregion
 
 #pragma region Match In Progress
@@ -141,6 +227,11 @@ public:
      */
     uint16 GetMatchLengthInSeconds() const;
 
+    /**
+     * @brief Check for whether there's match time left.
+     */
+    bool IsThereMatchTimeLeft() const;
+
 protected:
     /**
      * @brief How long a match will last without interruptions or pauses.
@@ -153,19 +244,99 @@ protected:
      */
     virtual void HandleMatchHasStarted() override;
 
+private:
+    /**
+     * @brief Timer for the match length. It only runs while a round is in
+     * progress, so it's paused between rounds.
+     */
+    FTimerHandle MatchTimerHandle;
+
+    /**
+     * @brief Whether the match timer has run out.
+     */
+    bool HasMatchTimeRunOut = false;
+
+    /**
+     * @brief Callback for when the match timer expires.
+     */
+    void HandleMatchTimeRunOut();
+
 #pragma region Round State
 
 private:
+    /**
+     * @brief Calls the round state callbacks when the round phase changes.
+     */
+    void HandlePhaseChanged(const FTDPhaseChangedEvent& Event);
+
     /**
      * @brief Callback for when round state has been set to WaitingPreRound.
+     * Disables movement and queues the pre-round reset.
      */
-    UFUNCTION()
     void HandleRoundIsWaitingToStart();
 
     /**
-     * @brief Spawns all players that are on an active team.
+     * @brief The most time that the pre-round reset may take each frame. At
+     * least one orb or player is reset per frame regardless.
+     */
+    UPROPERTY(EditAnywhere, Category = "Round State")
+    float PreRoundResetBudgetInMilliseconds = 1.0f;
+
+    /**
+     * @brief The orbs left to destroy before the round starts.
+     */
+    TArray<TWeakObjectPtr<AOrb>> PreRoundOrbQueue;
+
+    /**
+     * @brief The players left to spawn before the round starts.
      */
-    void SpawnActivePlayers();
+    TArray<TWeakObjectPtr<ATDController>> PreRoundPlayerQueue;
+
+    /**
+     * @brief Timer for processing the rest of the pre-round reset next frame.
+     */
+    FTimerHandle PreRoundResetTimerHandle;
+
+    /**
+     * @brief Queues every orb to be destroyed and every player to be spawned,
+     * then starts processing the queue. Instead of resetting everything in
+     * the frame that the round starts waiting, the reset is spread across
+     * frames within the round start delay.
+     */
+    void QueuePreRoundReset();
+
+    /**
+     * @brief Processes the pre-round reset queue until it's empty or this
+     * frame's budget runs out, in which case it continues next frame.
+     */
+    void ProcessPreRoundReset();
+
+    /**
+     * @brief Processes whatever is left of the pre-round reset queue
+     * regardless of the budget. Called right before the round (or overtime)
+     * starts so that the reset is always complete by then.
+     */
+    void FinishPreRoundReset();
+
+    /**
+     * @brief Destroys the next queued orb, or spawns the next queued player if
+     * there are no orbs left.
+     * @return Whether there was anything left in the queue.
+     */
+    bool ProcessNextPreRoundReset();
+
+    /**
+     * @brief Spawns the player if they're on an active team. If they already
+     * have a character, including an eliminated one, it's reactivated at a
+     * player start instead.
+     */
+    void SpawnActivePlayer(ATDController* Player);
+
+    /**
+     * @brief Moves the player's existing character to the next player start
+     * and reactivates it.
+     */
+    void ReactivatePlayer(ATDController* Player, ATDCharacter* Character);
 
     /**
      * @brief Stops players from being able to move.
@@ -175,7 +346,6 @@ private:
     /**
      * @brief Callback for when round state has been set to RoundInProgress.
      */
-    UFUNCTION()
     void HandleRoundHasStarted();
 
     /**
@@ -186,13 +356,11 @@ private:
     /**
      * @brief Callback for when round state has been set to WaitingPostRound.
      */
-    UFUNCTION()
     void HandleRoundHasEnded();
 
     /**
      * @brief Callback for when round state has been set to RoundInOvertime.
      */
-    UFUNCTION()
     void HandleOvertimeHasStarted();
 
     /**
@@ -259,6 +427,34 @@ private:
      */
     bool ReadyToRestartMatch() const;
 
+    /**
+     * @brief Timer for the delay before restarting the match.
+     */
+    FTimerHandle MatchRestartDelayTimerHandle;
+
+    /**
+     * @brief Whether the match restart delay has passed.
+     */
+    bool HasMatchRestartDelayPassed = false;
+
+    /**
+     * @brief Callback for when the match restart delay timer expires.
+     */
+    void HandleMatchRestartDelayPassed();
+
+    /**
+     * @brief Resets the match in place and sets the match state back to
+     * WaitingToStart. Unlike RestartGame(), the map isn't travelled to again,
+     * so clients stay connected and actors aren't respawned.
+     */
+    void RestartMatch();
+
+    /**
+     * @brief Destroys every player's pawn, puts them back into spectating and
+     * resets their round state.
+     */
+    void ResetPlayers();
+
 #pragma endregion
 
 #pragma region Match Failure
@@ -287,7 +483,8 @@ public:
 
 private:
     /**
-     * @brief Eliminates a player by destroying their character.
+     * @brief Eliminates a player by deactivating their character, then
+     * requests a match state evaluation since the round may be over.
      * @param Player The player to be eliminated.
      */
     void EliminatePlayer(ATDCharacter* Player);
@@ -306,8 +503,7 @@ public:
      * @param Player The PlayerController that is requesting to switch teams.
      * @param Team The team enum to switch to.
      */
-    void SwitchPlayerToTeam(ATDController* Player,
-        const ETeamIndex Team) const;
+    void SwitchPlayerToTeam(ATDController* Player, const ETeamIndex Team);
 
 #pragma endregion
 };
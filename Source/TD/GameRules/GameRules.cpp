@@ -2,9 +2,10 @@
 
 #include "GameRules.h"
 
-#include "GameFramework/GameMode.h"
-#include "GameModes/RoundStateMachine.h"
+#include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
 #include "GameState/TDGameState.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "Orb/Orb.h"
 #include "Player/TDCharacter.h"
@@ -16,6 +17,8 @@ AGameRules::AGameRules()
     bReplicates = true;
     bAlwaysRelevant = true;
     SetReplicatingMovement(false);
+    // Only replicates its game state, so it's flushed when that's set.
+    NetDormancy = DORM_DormantAll;
 
     // Might not be necessary
     bNetLoadOnClient = false;
@@ -24,30 +27,46 @@ AGameRules::AGameRules()
 void AGameRules::SetGameState(const ATDGameState* GameState)
 {
     TDGameState = GameState;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AGameRules, TDGameState, this);
+    FlushNetDormancy();
+}
+
+void AGameRules::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    UTDWorldRegistry::RegisterInWorld(this);
+}
+
+void AGameRules::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UTDWorldRegistry::UnregisterFromWorld(this);
+    Super::EndPlay(EndPlayReason);
 }
 
 void AGameRules::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(AGameRules, TDGameState);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AGameRules, TDGameState, Params);
 }
 
 #pragma endregion
 
-bool AGameRules::CanCastOrb() const
+bool AGameRules::CanCastOrb(const ATDCharacter* Player) const
 {
-    return IsInPlay();
+    return IsInPlay() && IsPlayerActive(Player);
 }
 
-bool AGameRules::CanPull() const
+bool AGameRules::CanPull(const ATDCharacter* Player) const
 {
-    return IsInPlay();
+    return IsInPlay() && IsPlayerActive(Player);
 }
 
-bool AGameRules::CanPush() const
+bool AGameRules::CanPush(const ATDCharacter* Player) const
 {
-    return IsInPlay();
+    return IsInPlay() && IsPlayerActive(Player);
 }
 
 bool AGameRules::CanTelekineseOrb(const ATDCharacter* Player,
@@ -58,7 +77,8 @@ bool AGameRules::CanTelekineseOrb(const ATDCharacter* Player,
         return false;
     }
 
-    return IsInPlay() && Player->GetTeam() == Orb->GetTeam();
+    return IsInPlay() && IsPlayerActive(Player) &&
+        Player->GetTeam() == Orb->GetTeam();
 }
 
 bool AGameRules::IsInPlay() const
@@ -68,7 +88,10 @@ bool AGameRules::IsInPlay() const
         return false;
     }
 
-    return TDGameState->GetMatchState() == MatchState::InProgress &&
-           (TDGameState->GetRoundState() == RoundState::RoundInProgress ||
-            TDGameState->GetRoundState() == RoundState::RoundInOvertime);
+    return TDGameState->IsInPlay();
+}
+
+bool AGameRules::IsPlayerActive(const ATDCharacter* Player)
+{
+    return Player != nullptr && !Player->GetIsDeactivated();
 }
@@ -27,7 +27,22 @@ class TD_API AGameRules : public AInfo
 
 public:
     AGameRules();
+
+    /**
+     * @brief Sets the game state and wakes the rules so that it replicates.
+     * The rules are dormant otherwise.
+     */
     void SetGameState(const ATDGameState* GameState);
+
+    /**
+     * @brief Registers with the UTDWorldRegistry.
+     */
+    virtual void PostInitializeComponents() override;
+
+    /**
+     * @brief Unregisters from the UTDWorldRegistry.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(
         TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -42,18 +57,21 @@ private:
 public:
     /**
      * @brief Check for whether a player can cast an orb.
+     * @param Player The player who wants to cast.
      */
-    virtual bool CanCastOrb() const;
+    virtual bool CanCastOrb(const ATDCharacter* Player) const;
 
     /**
      * @brief Check for whether a player can perform a Pull.
+     * @param Player The player who wants to pull.
      */
-    virtual bool CanPull() const;
+    virtual bool CanPull(const ATDCharacter* Player) const;
 
     /**
      * @brief Check for whether a player can perform a Push.
+     * @param Player The player who wants to push.
      */
-    virtual bool CanPush() const;
+    virtual bool CanPush(const ATDCharacter* Player) const;
 
     /**
      * @brief Check for whether a player can push or pull an orb.
@@ -69,5 +87,12 @@ protected:
      */
     virtual bool IsInPlay() const;
 
+    /**
+     * @brief Check for whether the player exists and hasn't been eliminated.
+     * Eliminated characters stay possessed until they're reactivated, so their
+     * abilities can still be activated.
+     */
+    static bool IsPlayerActive(const ATDCharacter* Player);
+
 #pragma endregion
 };
@@ -0,0 +1,108 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "CueState.h"
+
+#include "GameConfiguration.h"
+#include "TDCueRegistry.h"
+#include "GameState/TDGameState.h"
+#include "Orb/Orb.h"
+#include "Player/TDController.h"
+
+#pragma region Initialization
+
+UCueState::UCueState()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    // After every actor has ticked and before the net driver sends packets.
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+#pragma endregion
+
+#pragma region Cues
+
+void UCueState::PlayReplicatedCueAtLocation(USoundBase* Sound,
+    const FVector& Location, AActor* Source)
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        FVector CueLocation = Location;
+        TDGameState->PlayLocalCue(Sound, &CueLocation);
+        return;
+    }
+
+    const uint8 CueId = UTDCueRegistry::Get()->GetCueId(Sound);
+    if (CueId == UTDCueRegistry::InvalidCueId)
+    {
+        LogInvalidPointer("UCueState", "PlayReplicatedCueAtLocation", "CueId",
+            "Did you add the sound to the cue registry in DefaultGame.ini?");
+        return;
+    }
+
+    FTDCue& Cue = QueuedCues.AddDefaulted_GetRef();
+    Cue.CueId = CueId;
+    Cue.Location = Location;
+    Cue.Source = Source;
+    SetComponentTickEnabled(true);
+}
+
+void UCueState::PlayCues(const TArray<FTDCue>& Cues) const
+{
+    UTDCueRegistry* Registry = UTDCueRegistry::Get();
+    for (const FTDCue& Cue : Cues)
+    {
+        USoundBase* Sound = Registry->GetCue(Cue.CueId);
+        AOrb* Orb = Cast<AOrb>(Cue.Source);
+        if (Sound == nullptr || (Orb != nullptr &&
+                                 Orb->GetAreCosmeticsClientDerived() &&
+                                 !Orb->ConsumeCosmeticCue(Sound)))
+        {
+            continue;
+        }
+        FVector CueLocation = Cue.Location;
+        TDGameState->PlayLocalCue(Sound, &CueLocation);
+    }
+}
+
+void UCueState::TickComponent(float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    SetComponentTickEnabled(false);
+
+    UTDCueRegistry* Registry = UTDCueRegistry::Get();
+    for (FConstPlayerControllerIterator It =
+             GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        ATDController* Controller = Cast<ATDController>(It->Get());
+        if (Controller == nullptr)
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        Controller->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        Bundle.Reset();
+        for (const FTDCue& Cue : QueuedCues)
+        {
+            if (FVector::DistSquared(ViewLocation, Cue.Location) <=
+                Registry->GetAudibleDistanceSquared(Cue.CueId))
+            {
+                Bundle.Emplace(Cue);
+                if (Bundle.Num() == MaxCuesPerBundle)
+                {
+                    break;
+                }
+            }
+        }
+        if (Bundle.Num() > 0)
+        {
+            Controller->Client_PlayCues(Bundle);
+        }
+    }
+    QueuedCues.Reset();
+}
+
+#pragma endregion
@@ -0,0 +1,99 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TDGameStateComponent.h"
+#include "Engine/NetSerialization.h"
+#include "CueState.generated.h"
+
+class USoundBase;
+
+/**
+ * @brief A cue to play at a location, as it's sent to clients.
+ * @see UTDCueRegistry
+ */
+USTRUCT()
+struct TD_API FTDCue
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    uint8 CueId = 0;
+
+    UPROPERTY()
+    FVector_NetQuantize Location;
+
+    /**
+     * @brief The actor that played the cue, if clients need it to dedupe the
+     * cue against the ones they play themselves.
+     */
+    UPROPERTY()
+    AActor* Source = nullptr;
+};
+
+/**
+ * @brief Replicates sound cues. Instead of a multicast RPC per cue, the cues
+ * played during a frame are queued and, after every actor has ticked, each
+ * player is sent one unreliable bundle of the cues they're close enough to
+ * hear.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class TD_API UCueState : public UTDGameStateComponent
+{
+    GENERATED_BODY()
+
+#pragma region Initialization
+
+public:
+    UCueState();
+
+#pragma endregion
+
+#pragma region Cues
+
+public:
+    /**
+     * @brief Queues the cue to be sent to every player that can hear it on the
+     * server, or plays it locally on clients.
+     * @param Source The actor that played the cue. @see FTDCue::Source
+     */
+    void PlayReplicatedCueAtLocation(USoundBase* Sound,
+        const FVector& Location, AActor* Source = nullptr);
+
+    /**
+     * @brief Plays a bundle of cues received from the server, except for orb
+     * cues that the client already played itself.
+     * @see AOrb::ConsumeCosmeticCue
+     */
+    void PlayCues(const TArray<FTDCue>& Cues) const;
+
+    /**
+     * @brief Sends the queued cues to the players that can hear them.
+     */
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+        FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+    /**
+     * @brief The most cues sent to a player in one bundle. Any more are
+     * dropped, since they'd be drowned out anyway.
+     */
+    UPROPERTY(EditAnywhere)
+    int32 MaxCuesPerBundle = 32;
+
+private:
+    /**
+     * @brief The cues played this frame on the server.
+     */
+    TArray<FTDCue> QueuedCues;
+
+    /**
+     * @brief The bundle being built for each player. Kept to reuse its
+     * allocation.
+     */
+    TArray<FTDCue> Bundle;
+
+#pragma endregion
+};
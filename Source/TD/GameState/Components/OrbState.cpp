@@ -2,8 +2,8 @@
 
 #include "OrbState.h"
 
-#include "EngineUtils.h"
 #include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
 #include "GameState/TDGameState.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
@@ -55,11 +55,24 @@ void UOrbState::TickComponent(float DeltaTime, ELevelTick TickType,
     }
 }
 
+void UOrbState::BeginPlay()
+{
+    Super::BeginPlay();
+    TDGameState->GetEventBus().Subscribe<FTDOrbSwappedEvent, UOrbState,
+        &UOrbState::HandleOrbSwapped>(this);
+}
+
+void UOrbState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TDGameState->GetEventBus().UnsubscribeAll(this);
+    Super::EndPlay(EndPlayReason);
+}
+
 #pragma endregion
 
 #pragma region Game State Events
 
-void UOrbState::HandleRoundIsWaitingToStart()
+void UOrbState::HandleMatchIsWaitingToStart()
 {
     ResetPlayerOrbs();
 }
@@ -96,9 +109,17 @@ void UOrbState::ResetPlayerOrb(ATDCharacter* Player, AOrb* NewOrb)
 
 void UOrbState::ResetPlayerOrbs() const
 {
-    for (TActorIterator<AOrb> It(GetWorld()); It; ++It)
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
+    {
+        LogInvalidPointer("UOrbState", "ResetPlayerOrbs", "Registry");
+        return;
+    }
+
+    // Copied because destroying an orb unregisters it.
+    const TArray<AOrb*> Orbs = Registry->GetOrbs();
+    for (AOrb* Orb : Orbs)
     {
-        AOrb* Orb = *It;
         if (IsValid(Orb) && !Orb->IsActorBeingDestroyed())
         {
             Orb->Destroy();
@@ -118,18 +139,50 @@ void UOrbState::HandleOrbImpact(AOrb* InstigatorOrb, const FHitResult& Hit)
         HitOrb->GetTeam() != InstigatorOrb->GetTeam() &&
         !OrbCollisions.Contains(OrbCollision))
     {
-        SwapOrbTeams(InstigatorOrb, HitOrb);
         OrbCollisions.Emplace(OrbCollision);
-        PlayOrbCollisionCue(Hit.Location);
+        SwapOrbTeams(InstigatorOrb, HitOrb, Hit.Location);
     }
 }
 
-void UOrbState::SwapOrbTeams(AOrb* InstigatorOrb, AOrb* HitOrb) const
+void UOrbState::HandleSimulatedOrbImpact(AOrb* InstigatorOrb,
+    const FHitResult& Hit)
+{
+    AOrb* HitOrb = Cast<AOrb>(Hit.GetActor());
+    if (HitOrb == nullptr || HitOrb->GetTeam() == InstigatorOrb->GetTeam() ||
+        OrbCollisionCue == nullptr)
+    {
+        return;
+    }
+
+    const FOrbCollision OrbCollision = CreateOrbCollision(InstigatorOrb,
+        HitOrb);
+    if (OrbCollisions.Contains(OrbCollision))
+    {
+        return;
+    }
+    OrbCollisions.Emplace(OrbCollision);
+
+    // Consumed on both orbs, since the server's cue comes from whichever orb
+    // it saw as the instigator.
+    const bool IsNewForInstigator = InstigatorOrb->ConsumeCosmeticCue(
+        OrbCollisionCue);
+    const bool IsNewForHitOrb = HitOrb->ConsumeCosmeticCue(OrbCollisionCue);
+    if (IsNewForInstigator && IsNewForHitOrb)
+    {
+        FVector Location = Hit.Location;
+        TDGameState->PlayLocalCue(OrbCollisionCue, &Location);
+    }
+}
+
+void UOrbState::SwapOrbTeams(AOrb* InstigatorOrb, AOrb* HitOrb,
+    const FVector& Location) const
 {
     ETeamIndex ITeam = InstigatorOrb->GetTeam();
     ETeamIndex HTeam = HitOrb->GetTeam();
     InstigatorOrb->SetTeam(HTeam);
     HitOrb->SetTeam(ITeam);
+    TDGameState->GetEventBus().Broadcast(
+        FTDOrbSwappedEvent{InstigatorOrb, HitOrb, Location});
 }
 
 FOrbCollision UOrbState::CreateOrbCollision(AOrb* InstigatorOrb,
@@ -143,7 +196,12 @@ FOrbCollision UOrbState::CreateOrbCollision(AOrb* InstigatorOrb,
     return OrbCollision;
 }
 
-void UOrbState::PlayOrbCollisionCue(
+void UOrbState::HandleOrbSwapped(const FTDOrbSwappedEvent& Event)
+{
+    PlayOrbCollisionCue(Event.InstigatorOrb, Event.Location);
+}
+
+void UOrbState::PlayOrbCollisionCue(AOrb* InstigatorOrb,
     const FVector& Location) const
 {
     if (OrbCollisionCue == nullptr)
@@ -153,7 +211,8 @@ void UOrbState::PlayOrbCollisionCue(
         return;
     }
 
-    TDGameState->PlayReplicatedCueAtLocation(OrbCollisionCue, Location);
+    TDGameState->PlayReplicatedCueAtLocation(OrbCollisionCue, Location,
+        InstigatorOrb);
 }
 
 #pragma endregion
@@ -12,6 +12,7 @@
 class USoundCue;
 class ATDCharacter;
 class AOrb;
+struct FTDOrbSwappedEvent;
 
 #define COLLISION_CLEAR_DIST 10.0f
 
@@ -61,13 +62,21 @@ public:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType,
         FActorComponentTickFunction* ThisTickFunction) override;
 
+protected:
+    /**
+     * @brief Subscribes to orb swaps on the game state's event bus.
+     */
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 #pragma endregion
 
 #pragma region Game State Events
     /** @see UTDGameStateComponent */
 
 protected:
-    virtual void HandleRoundIsWaitingToStart() override;
+    virtual void HandleMatchIsWaitingToStart() override;
     virtual void HandleMatchHasEnded() override;
 
 #pragma endregion
@@ -106,11 +115,21 @@ public:
     void HandleOrbImpact(AOrb* InstigatorOrb, const FHitResult& Hit);
 
     /**
-     * @brief Swaps the teams of two orbs that hit each other.
+     * @brief Called on clients when a simulated orb impacts something else.
+     * Plays the orb collision cue if the orbs are on different teams, without
+     * swapping them, since that's up to the server.
+     */
+    void HandleSimulatedOrbImpact(AOrb* InstigatorOrb, const FHitResult& Hit);
+
+    /**
+     * @brief Swaps the teams of two orbs that hit each other and publishes the
+     * swap. @see FTDOrbSwappedEvent
      * @param InstigatorOrb The orb that caused the hit.
      * @param HitOrb The orb that is being hit.
+     * @param Location Where the orbs hit each other.
      */
-    void SwapOrbTeams(AOrb* InstigatorOrb, AOrb* HitOrb) const;
+    void SwapOrbTeams(AOrb* InstigatorOrb, AOrb* HitOrb,
+        const FVector& Location) const;
 
 protected:
     /**
@@ -137,7 +156,13 @@ private:
      */
     FOrbCollision CreateOrbCollision(AOrb* InstigatorOrb, AOrb* HitOrb) const;
 
-    void PlayOrbCollisionCue(const FVector& Location) const;
+    /**
+     * @brief Plays the orb collision cue where the swapped orbs hit.
+     */
+    void HandleOrbSwapped(const FTDOrbSwappedEvent& Event);
+
+    void PlayOrbCollisionCue(AOrb* InstigatorOrb,
+        const FVector& Location) const;
 
 #pragma endregion
 };
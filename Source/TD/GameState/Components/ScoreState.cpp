@@ -2,17 +2,47 @@
 
 #include "ScoreState.h"
 
+#include "GameConfiguration.h"
 #include "TDTypes.h"
 #include "TeamState.h"
 #include "GameState/TDGameState.h"
 #include "GameState/UIGameState.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 
+#pragma region Team Score Items
+
+void FTeamScoreItem::PostReplicatedAdd(
+    const FTeamScoreItems& InArraySerializer)
+{
+    if (InArraySerializer.ScoreState == nullptr)
+    {
+        LogInvalidPointer("FTeamScoreItem", "PostReplicatedAdd", "ScoreState");
+        return;
+    }
+    InArraySerializer.ScoreState->HandleTeamScoreItemsReplicated();
+}
+
+void FTeamScoreItem::PostReplicatedChange(
+    const FTeamScoreItems& InArraySerializer)
+{
+    if (InArraySerializer.ScoreState == nullptr)
+    {
+        LogInvalidPointer("FTeamScoreItem", "PostReplicatedChange",
+            "ScoreState");
+        return;
+    }
+    InArraySerializer.ScoreState->HandleTeamScoreItemsReplicated();
+}
+
+#pragma endregion
+
 #pragma region Initialization
 
 UScoreState::UScoreState()
 {
     SetIsReplicatedByDefault(true);
+    TeamScoreItems.ScoreState = this;
     FillTeamScores();
 }
 
@@ -20,9 +50,10 @@ void UScoreState::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UScoreState, TeamScores);
-    DOREPLIFETIME(UScoreState, RoundWinningTeams);
-    DOREPLIFETIME(UScoreState, MatchWinningTeams);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UScoreState, TeamScoreItems, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(UScoreState, MatchWinningTeams, Params);
 }
 
 void UScoreState::FillTeamScores()
@@ -33,18 +64,92 @@ void UScoreState::FillTeamScores()
     }
 }
 
+void UScoreState::BeginPlay()
+{
+    Super::BeginPlay();
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        FillTeamScoreItems();
+    }
+    TDGameState->GetEventBus().Subscribe<FTDPhaseChangedEvent, UScoreState,
+        &UScoreState::HandlePhaseChanged>(this);
+}
+
+void UScoreState::FillTeamScoreItems()
+{
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
+    {
+        FTeamScoreItem& Item = TeamScoreItems.Items.AddDefaulted_GetRef();
+        Item.Team = Index;
+        Item.Score = TeamScores[Int(Index)];
+        Item.IsRoundWinner = RoundWinningTeams.Contains(Index);
+        MarkTeamScoreItemDirty(Item);
+    }
+}
+
 void UScoreState::HandleRoundIsWaitingToStart()
 {
     TArray<ETeamIndex> ResetRoundWinningTeams;
     ResetRoundWinningTeams.Emplace(ETeamIndex::None);
-    RoundWinningTeams = ResetRoundWinningTeams;
-    UIGameState->SetRoundWinningTeams(RoundWinningTeams);
+    SetRoundWinningTeams(ResetRoundWinningTeams);
 }
 
 #pragma endregion
 
 #pragma region Game State Events
 
+void UScoreState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TDGameState->GetEventBus().UnsubscribeAll(this);
+    Super::EndPlay(EndPlayReason);
+}
+
+void UScoreState::HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
+{
+    if (Event.OldRoundPhase == Event.RoundPhase)
+    {
+        return;
+    }
+
+    if (Event.RoundPhase == ERoundPhase::WaitingPreRound)
+    {
+        HandleRoundIsWaitingToStart();
+    }
+    else if (Event.RoundPhase == ERoundPhase::WaitingPostRound)
+    {
+        HandleRoundHasEnded();
+    }
+}
+
+/**
+ * @brief Resets every team's score and the winning teams, since the match can
+ * be restarted without reloading the map.
+ */
+void UScoreState::HandleMatchIsWaitingToStart()
+{
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    for (FTeamScoreItem& Item : TeamScoreItems.Items)
+    {
+        if (Item.Score == 0)
+        {
+            continue;
+        }
+        Item.Score = 0;
+        TeamScores[Int(Item.Team)] = 0;
+        MarkTeamScoreItemDirty(Item);
+        TDGameState->GetEventBus().Broadcast(
+            FTDScoreChangedEvent{Item.Team, Item.Score});
+    }
+    SetRoundWinningTeams(TArray<ETeamIndex>());
+    MatchWinningTeams.Reset();
+    MARK_PROPERTY_DIRTY_FROM_NAME(UScoreState, MatchWinningTeams, this);
+    UIGameState->SetMatchWinningTeams(MatchWinningTeams);
+}
+
 void UScoreState::HandleRoundHasEnded()
 {
     if (GetOwnerRole() != ROLE_Authority)
@@ -52,11 +157,10 @@ void UScoreState::HandleRoundHasEnded()
         return;
     }
     UTeamState* TeamState = TDGameState->GetTeamStateComponent();
-    TArray<FTeam> WinningTeams = TeamState->
+    TArray<ETeamIndex> WinningTeams = TeamState->
         GetActiveTeamsWithNoEliminatedPlayers();
     AddScoreToTeams(WinningTeams);
-    RoundWinningTeams = ConvertTeamsToIndices(WinningTeams);
-    UIGameState->SetRoundWinningTeams(RoundWinningTeams);
+    SetRoundWinningTeams(WinningTeams);
 }
 
 void UScoreState::HandleOvertimeHasEnded()
@@ -66,7 +170,7 @@ void UScoreState::HandleOvertimeHasEnded()
         return;
     }
     UTeamState* TeamState = TDGameState->GetTeamStateComponent();
-    TArray<FTeam> WinningTeams = TeamState->
+    TArray<ETeamIndex> WinningTeams = TeamState->
         GetActiveTeamsWithNoEliminatedPlayers();
     AddScoreToTeams(WinningTeams);
 }
@@ -74,6 +178,7 @@ void UScoreState::HandleOvertimeHasEnded()
 void UScoreState::HandleMatchHasEnded()
 {
     MatchWinningTeams = GetTeamIndicesWithScore(GetTeamMaxScore());
+    MARK_PROPERTY_DIRTY_FROM_NAME(UScoreState, MatchWinningTeams, this);
     UIGameState->SetMatchWinningTeams(MatchWinningTeams);
 }
 
@@ -104,14 +209,50 @@ TArray<ETeamIndex> UScoreState::GetTeamIndicesWithScore(uint8 Score) const
 
 #pragma region Score State
 
-void UScoreState::OnRep_TeamScores()
+void UScoreState::HandleTeamScoreItemsReplicated()
 {
-    UIGameState->SetTeamScores(TeamScores);
+    RoundWinningTeams.Reset();
+    for (const FTeamScoreItem& Item : TeamScoreItems.Items)
+    {
+        if (TeamScores[Int(Item.Team)] != Item.Score)
+        {
+            TeamScores[Int(Item.Team)] = Item.Score;
+            TDGameState->GetEventBus().Broadcast(
+                FTDScoreChangedEvent{Item.Team, Item.Score});
+        }
+        if (Item.IsRoundWinner)
+        {
+            RoundWinningTeams.Emplace(Item.Team);
+        }
+    }
+    UIGameState->SetRoundWinningTeams(RoundWinningTeams);
 }
 
-void UScoreState::OnRep_RoundWinningTeams()
+void UScoreState::SetRoundWinningTeams(
+    const TArray<ETeamIndex>& NewRoundWinningTeams)
 {
+    RoundWinningTeams = NewRoundWinningTeams;
     UIGameState->SetRoundWinningTeams(RoundWinningTeams);
+    if (GetOwnerRole() != ROLE_Authority)
+    {
+        return;
+    }
+
+    for (FTeamScoreItem& Item : TeamScoreItems.Items)
+    {
+        const bool IsRoundWinner = RoundWinningTeams.Contains(Item.Team);
+        if (Item.IsRoundWinner != IsRoundWinner)
+        {
+            Item.IsRoundWinner = IsRoundWinner;
+            MarkTeamScoreItemDirty(Item);
+        }
+    }
+}
+
+void UScoreState::MarkTeamScoreItemDirty(FTeamScoreItem& Item)
+{
+    TeamScoreItems.MarkItemDirty(Item);
+    MARK_PROPERTY_DIRTY_FROM_NAME(UScoreState, TeamScoreItems, this);
 }
 
 void UScoreState::OnRep_MatchWinningTeams()
@@ -119,18 +260,22 @@ void UScoreState::OnRep_MatchWinningTeams()
     UIGameState->SetMatchWinningTeams(MatchWinningTeams);
 }
 
-void UScoreState::AddScoreToTeams(const TArray<FTeam>& Teams)
+void UScoreState::AddScoreToTeams(const TArray<ETeamIndex>& Teams)
 {
-    for (const FTeam& Team : Teams)
+    for (const ETeamIndex Team : Teams)
     {
         AddScoreToTeam(Team);
     }
 }
 
-void UScoreState::AddScoreToTeam(const FTeam& Team)
+void UScoreState::AddScoreToTeam(const ETeamIndex Team)
 {
-    TeamScores[Int(Team.Index)]++;
-    UIGameState->SetTeamScores(TeamScores);
+    TeamScores[Int(Team)]++;
+    FTeamScoreItem& Item = TeamScoreItems.Items[Int(Team)];
+    Item.Score = TeamScores[Int(Team)];
+    MarkTeamScoreItemDirty(Item);
+    TDGameState->GetEventBus().Broadcast(
+        FTDScoreChangedEvent{Team, Item.Score});
 }
 
 #pragma endregion
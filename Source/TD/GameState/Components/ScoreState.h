@@ -5,11 +5,70 @@
 #include "CoreMinimal.h"
 
 #include "TDGameStateComponent.h"
+#include "TDTypes.h"
+#include "Engine/NetSerialization.h"
 #include "ScoreState.generated.h"
 
 class UUIGameState;
-enum class ETeamIndex : uint8;
+struct FTDPhaseChangedEvent;
 struct FTeam;
+class UScoreState;
+
+/**
+ * @brief A team's score and whether they won the last round. One item per
+ * team, so scoring only sends the teams that scored.
+ */
+USTRUCT()
+struct TD_API FTeamScoreItem : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    ETeamIndex Team = ETeamIndex::None;
+
+    UPROPERTY()
+    uint8 Score = 0;
+
+    UPROPERTY()
+    bool IsRoundWinner = false;
+
+    /** @see FFastArraySerializerItem */
+    void PostReplicatedAdd(const struct FTeamScoreItems& InArraySerializer);
+    void PostReplicatedChange(const struct FTeamScoreItems& InArraySerializer);
+};
+
+/**
+ * @brief Delta replicated array of every team's score.
+ */
+USTRUCT()
+struct TD_API FTeamScoreItems : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FTeamScoreItem> Items;
+
+    /**
+     * @brief The score state that's notified when scores replicate.
+     */
+    UScoreState* ScoreState = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FTeamScoreItem,
+            FTeamScoreItems>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FTeamScoreItems> : public
+    TStructOpsTypeTraitsBase2<FTeamScoreItems>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TD_API UScoreState : public UTDGameStateComponent
@@ -23,24 +82,47 @@ public:
     virtual void GetLifetimeReplicatedProps(
         TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+protected:
+    virtual void BeginPlay() override;
+
 private:
     /**
-     * @brief Fills the Teams array with all of the available teams.
+     * @brief Fills the team scores with a score for every team.
      */
     void FillTeamScores();
 
+    /**
+     * @brief Fills the replicated team score items on the server. Not done in
+     * the constructor, otherwise clients would have their own unreplicated
+     * copies of each item.
+     */
+    void FillTeamScoreItems();
+
 #pragma endregion
 
 #pragma region Game State Events
     /** @see UTDGameStateComponent */
 
 protected:
-    virtual void HandleRoundIsWaitingToStart() override;
-    virtual void HandleRoundHasEnded() override;
+    virtual void HandleMatchIsWaitingToStart() override;
     virtual void HandleOvertimeHasEnded() override;
     virtual void HandleMatchHasEnded() override;
 
+    /**
+     * @brief Unsubscribes from the game state's event bus.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
+    /**
+     * @brief Resets the round winners when a round is waiting to start and
+     * scores the round when it ends.
+     */
+    void HandlePhaseChanged(const FTDPhaseChangedEvent& Event);
+
+    void HandleRoundIsWaitingToStart();
+    void HandleRoundHasEnded();
+
     uint8 GetTeamMaxScore() const;
     TArray<ETeamIndex> GetTeamIndicesWithScore(uint8 Score) const;
 
@@ -50,28 +132,47 @@ private:
 
 private:
     /**
-     * @brief Array for each team's scores, indexed by ETeamIndex.
+     * @brief Array for each team's scores, indexed by ETeamIndex. Not
+     * replicated directly; clients rebuild it from TeamScoreItems.
      */
-    UPROPERTY(ReplicatedUsing=OnRep_TeamScores)
+    UPROPERTY(VisibleInstanceOnly)
     TArray<uint8> TeamScores;
 
-    UPROPERTY(ReplicatedUsing=OnRep_RoundWinningTeams)
+    /**
+     * @brief The teams that won the last round. Not replicated directly;
+     * clients rebuild it from TeamScoreItems.
+     */
+    UPROPERTY(VisibleInstanceOnly)
     TArray<ETeamIndex> RoundWinningTeams;
 
+    /**
+     * @brief Each team's score and whether they won the last round, indexed by
+     * ETeamIndex on the server. Push based, along with MatchWinningTeams.
+     */
+    UPROPERTY(Replicated)
+    FTeamScoreItems TeamScoreItems;
+
     UPROPERTY(ReplicatedUsing=OnRep_MatchWinningTeams)
     TArray<ETeamIndex> MatchWinningTeams;
 
     /**
-     * @brief Sets the UIGameState's team scores.
+     * @brief Rebuilds the team scores and round winning teams on clients,
+     * publishes the scores that changed and sets the UIGameState's round
+     * winning teams.
      */
-    UFUNCTION()
-    void OnRep_TeamScores();
+    void HandleTeamScoreItemsReplicated();
 
     /**
-     * @brief Sets the UIGameState's round winning teams.
+     * @brief Sets the round winning teams and marks the teams whose
+     * IsRoundWinner changed for replication.
      */
-    UFUNCTION()
-    void OnRep_RoundWinningTeams();
+    void SetRoundWinningTeams(const TArray<ETeamIndex>& NewRoundWinningTeams);
+
+    /**
+     * @brief Marks the item dirty in the fast array and marks TeamScoreItems
+     * dirty for push model replication.
+     */
+    void MarkTeamScoreItemDirty(FTeamScoreItem& Item);
 
     /**
      * @brief Sets the UIGameState's match winning teams.
@@ -83,13 +184,13 @@ private:
      * @brief Adds a point to all passed in teams.
      * @param Teams The teams to add a point to.
      */
-    void AddScoreToTeams(const TArray<FTeam>& Teams);
+    void AddScoreToTeams(const TArray<ETeamIndex>& Teams);
 
     /**
      * @brief Adds a point to a single team.
      * @param Team The team to add a point to.
      */
-    void AddScoreToTeam(const FTeam& Team);
+    void AddScoreToTeam(const ETeamIndex Team);
 
 #pragma endregion
 
@@ -104,4 +205,5 @@ public:
 #pragma endregion
     friend class ATDGameState;
     friend class ADebugGameStateHUD;
+    friend struct FTeamScoreItem;
 };
@@ -10,22 +10,6 @@ void UTDGameStateComponent::HandleMatchHasStarted()
 {
 }
 
-void UTDGameStateComponent::HandleRoundIsWaitingToStart()
-{
-}
-
-void UTDGameStateComponent::HandleRoundHasStarted()
-{
-}
-
-void UTDGameStateComponent::HandleRoundHasEnded()
-{
-}
-
-void UTDGameStateComponent::HandleOvertimeHasStarted()
-{
-}
-
 void UTDGameStateComponent::HandleOvertimeHasEnded()
 {
 }
@@ -11,8 +11,9 @@ class ATDGameState;
 
 /**
  * @brief Base class for a component attached to TDGameState that is notified of
- * various match and round state changes. Also holds references to the
- * TDGameState and the UIGameState for convenience.
+ * match state changes. Round phase changes are published on the game state's
+ * event bus instead, for the components that need them. Also holds references
+ * to the TDGameState and the UIGameState for convenience.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TD_API UTDGameStateComponent : public UActorComponent
@@ -42,26 +43,6 @@ protected:
      */
     virtual void HandleMatchHasStarted();
 
-    /**
-     * @brief Callback for when round state has been set to WaitingPreRound.
-     */
-    virtual void HandleRoundIsWaitingToStart();
-
-    /**
-     * @brief Callback for when round state has been set to RoundInProgress.
-     */
-    virtual void HandleRoundHasStarted();
-
-    /**
-     * @brief Callback for when round state has been set to WaitingPostRound.
-     */
-    virtual void HandleRoundHasEnded();
-
-    /**
-     * @brief Callback for when round state has been set to RoundInOvertime.
-     */
-    virtual void HandleOvertimeHasStarted();
-
     /**
      * @brief Callback for after overtime has ended, but before the match has
      * ended.
@@ -2,19 +2,61 @@
 
 #include "TeamState.h"
 
-#include "EngineUtils.h"
 #include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
 #include "TDTypes.h"
 #include "Arena/TeamPlayerStart.h"
+#include "GameState/TDGameState.h"
 #include "GameState/UIGameState.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "Player/TDPlayerState.h"
 
+#pragma region Team Memberships
+
+void FTeamMembership::PreReplicatedRemove(
+    const FTeamMemberships& InArraySerializer)
+{
+    if (InArraySerializer.TeamState == nullptr)
+    {
+        LogInvalidPointer("FTeamMembership", "PreReplicatedRemove",
+            "TeamState");
+        return;
+    }
+    InArraySerializer.TeamState->HandleTeamMembershipRemoved(*this);
+}
+
+void FTeamMembership::PostReplicatedAdd(
+    const FTeamMemberships& InArraySerializer)
+{
+    if (InArraySerializer.TeamState == nullptr)
+    {
+        LogInvalidPointer("FTeamMembership", "PostReplicatedAdd", "TeamState");
+        return;
+    }
+    InArraySerializer.TeamState->HandleTeamMembershipChanged(*this);
+}
+
+void FTeamMembership::PostReplicatedChange(
+    const FTeamMemberships& InArraySerializer)
+{
+    if (InArraySerializer.TeamState == nullptr)
+    {
+        LogInvalidPointer("FTeamMembership", "PostReplicatedChange",
+            "TeamState");
+        return;
+    }
+    InArraySerializer.TeamState->HandleTeamMembershipChanged(*this);
+}
+
+#pragma endregion
+
 #pragma region Initialization
 
 UTeamState::UTeamState()
 {
     SetIsReplicatedByDefault(true);
+    TeamMemberships.TeamState = this;
     FillTeams();
     FillNextTeamPlayerStartIndices();
 }
@@ -23,7 +65,22 @@ void UTeamState::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UTeamState, Teams);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UTeamState, TeamMemberships, Params);
+}
+
+void UTeamState::BeginPlay()
+{
+    Super::BeginPlay();
+    TDGameState->GetEventBus().Subscribe<FTDPlayerEliminatedEvent, UTeamState,
+        &UTeamState::HandlePlayerEliminated>(this);
+}
+
+void UTeamState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    TDGameState->GetEventBus().UnsubscribeAll(this);
+    Super::EndPlay(EndPlayReason);
 }
 
 void UTeamState::FillTeams()
@@ -32,6 +89,8 @@ void UTeamState::FillTeams()
     {
         FTeam Team(Index);
         Teams.Add(Team);
+        TeamPlayerCounts.Emplace(0);
+        TeamPlayersLeftCounts.Emplace(0);
     }
 }
 
@@ -43,16 +102,15 @@ void UTeamState::FindAllTeamPlayerStarts()
         AllTeamPlayerStarts.Emplace(TArray<ATeamPlayerStart*>());
     }
 
-    UWorld* const World = GetWorld();
-    if (World == nullptr)
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
     {
-        LogInvalidPointer("UTeamState", "FindAllTeamPlayerStarts", "World");
+        LogInvalidPointer("UTeamState", "FindAllTeamPlayerStarts", "Registry");
         return;
     }
 
-    for (TActorIterator<ATeamPlayerStart> It(World); It; ++It)
+    for (ATeamPlayerStart* PlayerStart : Registry->GetTeamPlayerStarts())
     {
-        ATeamPlayerStart* PlayerStart = *It;
         const uint8 TeamIndex = PlayerStart->GetTeamIndex();
         AllTeamPlayerStarts[TeamIndex].Emplace(PlayerStart);
     }
@@ -75,33 +133,112 @@ const TArray<FTeam>& UTeamState::GetTeams() const
     return Teams;
 }
 
-void UTeamState::OnRep_Teams()
+void UTeamState::SetTeamMembership(ATDPlayerState* Player,
+    const ETeamIndex TeamIndex)
 {
-    UIGameState->SetTeams(Teams);
+    const int32 PlayerId = Player->GetPlayerId();
+    for (FTeamMembership& Membership : TeamMemberships.Items)
+    {
+        if (Membership.PlayerId == PlayerId)
+        {
+            if (Membership.Team != TeamIndex)
+            {
+                Membership.Team = TeamIndex;
+                MarkTeamMembershipDirty(Membership);
+            }
+            return;
+        }
+    }
+
+    FTeamMembership& Membership = TeamMemberships.Items.AddDefaulted_GetRef();
+    Membership.PlayerId = PlayerId;
+    Membership.Player = Player;
+    Membership.Team = TeamIndex;
+    MarkTeamMembershipDirty(Membership);
 }
 
-TArray<FTeam> UTeamState::GetActiveTeams() const
+void UTeamState::RemoveTeamMembership(const ATDPlayerState* Player)
 {
-    return Teams.FilterByPredicate([&](const FTeam& Team)
+    const int32 PlayerId = Player->GetPlayerId();
+    const int32 NumRemoved = TeamMemberships.Items.RemoveAll(
+        [PlayerId](const FTeamMembership& Membership)
+        {
+            return Membership.PlayerId == PlayerId;
+        });
+    if (NumRemoved > 0)
     {
-        return Team.IsActive;
-    });
+        TeamMemberships.MarkArrayDirty();
+        MARK_PROPERTY_DIRTY_FROM_NAME(UTeamState, TeamMemberships, this);
+    }
+}
+
+void UTeamState::MarkTeamMembershipDirty(FTeamMembership& Membership)
+{
+    TeamMemberships.MarkItemDirty(Membership);
+    MARK_PROPERTY_DIRTY_FROM_NAME(UTeamState, TeamMemberships, this);
 }
 
-TArray<FTeam> UTeamState::GetActiveTeamsWithPlayersLeft() const
+void UTeamState::HandleTeamMembershipChanged(
+    const FTeamMembership& Membership)
 {
-    return GetActiveTeams().FilterByPredicate([&](const FTeam& Team)
+    // The player may not have replicated yet, in which case this is called
+    // again once it has.
+    if (Membership.Player == nullptr)
+    {
+        return;
+    }
+
+    bool TeamsChanged = false;
+    for (FTeam& Team : Teams)
+    {
+        if (Team.Index == Membership.Team)
+        {
+            if (!Team.Players.Contains(Membership.Player))
+            {
+                Team.Players.Emplace(Membership.Player);
+                TeamsChanged = true;
+            }
+        }
+        else if (Team.Players.Remove(Membership.Player) > 0)
+        {
+            TeamsChanged = true;
+        }
+    }
+    // The membership also changes when its player replicates, without the
+    // player changing teams.
+    if (TeamsChanged)
     {
-        return DoesTeamHavePlayersLeft(Team);
-    });
+        TeamsVersion += 1;
+    }
+    UIGameState->SetTeams(Teams, TeamsVersion);
 }
 
-TArray<FTeam> UTeamState::GetActiveTeamsWithNoEliminatedPlayers() const
+void UTeamState::HandleTeamMembershipRemoved(
+    const FTeamMembership& Membership)
 {
-    return GetActiveTeams().FilterByPredicate([&](const FTeam& Team)
+    bool TeamsChanged = false;
+    for (FTeam& Team : Teams)
+    {
+        TeamsChanged |= Team.Players.Remove(Membership.Player) > 0;
+    }
+    if (TeamsChanged)
     {
-        return DoesTeamHaveNoEliminatedPlayers(Team);
-    });
+        TeamsVersion += 1;
+    }
+    UIGameState->SetTeams(Teams, TeamsVersion);
+}
+
+TArray<ETeamIndex> UTeamState::GetActiveTeamsWithNoEliminatedPlayers() const
+{
+    TArray<ETeamIndex> TeamIndices;
+    for (const FTeam& Team : Teams)
+    {
+        if (Team.IsActive && DoesTeamHaveNoEliminatedPlayers(Team.Index))
+        {
+            TeamIndices.Emplace(Team.Index);
+        }
+    }
+    return TeamIndices;
 }
 
 void UTeamState::SwitchPlayerToTeam(ATDPlayerState* Player,
@@ -113,19 +250,119 @@ void UTeamState::SwitchPlayerToTeam(ATDPlayerState* Player,
         return;
     }
 
+    bool TeamsChanged = false;
     for (FTeam& Team : Teams)
     {
-        if (Team.Index == TeamIndex && !Team.Players.Contains(Player))
+        if (Team.Index == TeamIndex)
         {
-            Team.Players.Emplace(Player);
+            if (!Team.Players.Contains(Player))
+            {
+                Team.Players.Emplace(Player);
+                UpdateTeamCounters(Team.Index, Player, 1);
+                TeamsChanged = true;
+            }
         }
-        else
+        else if (Team.Players.Remove(Player) > 0)
         {
-            Team.Players.Remove(Player);
+            UpdateTeamCounters(Team.Index, Player, -1);
+            TeamsChanged = true;
         }
     }
     Player->SetTeam(TeamIndex);
-    UIGameState->SetTeams(Teams);
+    SetTeamMembership(Player, TeamIndex);
+    if (TeamsChanged)
+    {
+        TeamsVersion += 1;
+    }
+    UIGameState->SetTeams(Teams, TeamsVersion);
+    CheckTeamCounters();
+}
+
+void UTeamState::RemovePlayer(ATDPlayerState* Player)
+{
+    if (Player == nullptr)
+    {
+        LogInvalidPointer("UTeamState", "RemovePlayer", "Player");
+        return;
+    }
+
+    bool TeamsChanged = false;
+    for (FTeam& Team : Teams)
+    {
+        if (Team.Players.Remove(Player) > 0)
+        {
+            UpdateTeamCounters(Team.Index, Player, -1);
+            TeamsChanged = true;
+        }
+    }
+    RemoveTeamMembership(Player);
+    if (TeamsChanged)
+    {
+        TeamsVersion += 1;
+    }
+    UIGameState->SetTeams(Teams, TeamsVersion);
+    CheckTeamCounters();
+}
+
+void UTeamState::HandlePlayerEliminated(const FTDPlayerEliminatedEvent& Event)
+{
+    const ATDPlayerState* Player = Event.Player;
+    if (Player == nullptr)
+    {
+        LogInvalidPointer("UTeamState", "HandlePlayerEliminated", "Player");
+        return;
+    }
+
+    const uint8 TeamIndex = Player->GetTeamIndex();
+    if (!Teams[TeamIndex].Players.Contains(Player))
+    {
+        return;
+    }
+
+    if (Event.IsEliminated)
+    {
+        TeamPlayersLeftCounts[TeamIndex] -= 1;
+    }
+    else
+    {
+        TeamPlayersLeftCounts[TeamIndex] += 1;
+    }
+    CheckTeamCounters();
+}
+
+#pragma endregion
+
+#pragma region Team Counters
+
+void UTeamState::UpdateTeamCounters(const ETeamIndex TeamIndex,
+    const ATDPlayerState* Player, const int8 Delta)
+{
+    TeamPlayerCounts[Int(TeamIndex)] += Delta;
+    if (!Player->GetIsEliminated())
+    {
+        TeamPlayersLeftCounts[Int(TeamIndex)] += Delta;
+    }
+}
+
+void UTeamState::CheckTeamCounters() const
+{
+#if !UE_BUILD_SHIPPING
+    for (const FTeam& Team : Teams)
+    {
+        uint8 PlayersLeft = 0;
+        for (const ATDPlayerState* const Player : Team.Players)
+        {
+            PlayersLeft += Player != nullptr && !Player->GetIsEliminated()
+                               ? 1
+                               : 0;
+        }
+        ensureMsgf(TeamPlayerCounts[Int(Team.Index)] == Team.Players.Num(),
+            TEXT("Team %d player count is out of sync."), Int(Team.Index));
+        ensureMsgf(TeamPlayersLeftCounts[Int(Team.Index)] == PlayersLeft,
+            TEXT("Team %d players left count is out of sync."),
+            Int(Team.Index));
+    }
+#endif
 }
 
 #pragma endregion
@@ -175,9 +412,9 @@ AActor* UTeamState::GetNextPlayerSpawn(AController* Player)
 
 bool UTeamState::DoesEachActiveTeamHaveAtLeastOnePlayer() const
 {
-    for (const FTeam& Team : GetActiveTeams())
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
     {
-        if (Team.Players.Num() < 1)
+        if (IsActiveTeam(Index) && TeamPlayerCounts[Int(Index)] < 1)
         {
             return false;
         }
@@ -187,9 +424,9 @@ bool UTeamState::DoesEachActiveTeamHaveAtLeastOnePlayer() const
 
 bool UTeamState::HasAPlayerBeenEliminated() const
 {
-    for (const FTeam& Team : GetActiveTeams())
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
     {
-        if (!DoesTeamHaveNoEliminatedPlayers(Team))
+        if (IsActiveTeam(Index) && !DoesTeamHaveNoEliminatedPlayers(Index))
         {
             return true;
         }
@@ -197,35 +434,27 @@ bool UTeamState::HasAPlayerBeenEliminated() const
     return false;
 }
 
-bool UTeamState::DoesTeamHavePlayersLeft(const FTeam& Team) const
+bool UTeamState::DoesTeamHavePlayersLeft(const ETeamIndex TeamIndex) const
 {
-    for (ATDPlayerState* const Player : Team.Players)
-    {
-        if (!Player->GetIsEliminated())
-        {
-            return true;
-        }
-    }
-    return false;
+    return TeamPlayersLeftCounts[Int(TeamIndex)] > 0;
 }
 
-bool UTeamState::DoesTeamHaveNoEliminatedPlayers(const FTeam& Team) const
+bool UTeamState::DoesTeamHaveNoEliminatedPlayers(
+    const ETeamIndex TeamIndex) const
 {
-    uint8 TotalPlayers = Team.Players.Num();
-    uint8 PlayersNotEliminated = 0;
-    for (ATDPlayerState* const Player : Team.Players)
-    {
-        PlayersNotEliminated += !Player->GetIsEliminated() ? 1 : 0;
-    }
-    return TotalPlayers == PlayersNotEliminated;
+    return TeamPlayersLeftCounts[Int(TeamIndex)] ==
+           TeamPlayerCounts[Int(TeamIndex)];
 }
 
 bool UTeamState::AreThereFewerThanTwoTeamsWithPlayersLeft() const
 {
     uint8 NumTeamsWithPlayersLeft = 0;
-    for (const FTeam& Team : GetActiveTeams())
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
     {
-        NumTeamsWithPlayersLeft += DoesTeamHavePlayersLeft(Team) ? 1 : 0;
+        if (IsActiveTeam(Index) && DoesTeamHavePlayersLeft(Index))
+        {
+            NumTeamsWithPlayersLeft += 1;
+        }
         if (NumTeamsWithPlayersLeft > 1)
         {
             return false;
@@ -6,12 +6,73 @@
 
 #include "TDGameStateComponent.h"
 #include "TDTypes.h"
+#include "Engine/NetSerialization.h"
 #include "TeamState.generated.h"
 
 class ATeamPlayerStart;
 class UUIGameState;
 enum class ETeamIndex : uint8;
 class ATDPlayerState;
+class UTeamState;
+struct FTDPlayerEliminatedEvent;
+
+/**
+ * @brief Which team a player is on, keyed by the player's ID. This is what's
+ * replicated instead of the teams array so that a team switch only sends the
+ * player that switched.
+ */
+USTRUCT()
+struct TD_API FTeamMembership : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 PlayerId = INDEX_NONE;
+
+    UPROPERTY()
+    ATDPlayerState* Player = nullptr;
+
+    UPROPERTY()
+    ETeamIndex Team = ETeamIndex::None;
+
+    /** @see FFastArraySerializerItem */
+    void PreReplicatedRemove(const struct FTeamMemberships& InArraySerializer);
+    void PostReplicatedAdd(const struct FTeamMemberships& InArraySerializer);
+    void PostReplicatedChange(const struct FTeamMemberships& InArraySerializer);
+};
+
+/**
+ * @brief Delta replicated array of every player's team membership.
+ */
+USTRUCT()
+struct TD_API FTeamMemberships : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FTeamMembership> Items;
+
+    /**
+     * @brief The team state that's notified when memberships replicate.
+     */
+    UTeamState* TeamState = nullptr;
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FTeamMembership,
+            FTeamMemberships>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FTeamMemberships> : public
+    TStructOpsTypeTraitsBase2<FTeamMemberships>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TD_API UTeamState : public UTDGameStateComponent
@@ -25,9 +86,18 @@ public:
     virtual void GetLifetimeReplicatedProps(
         TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+protected:
+    /**
+     * @brief Subscribes to player eliminations on the game state's event bus.
+     */
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 private:
     /**
-     * @brief Fills the teams array for each team in ETeamIndex.
+     * @brief Fills the teams array and the team counters for each team in
+     * ETeamIndex.
      */
     void FillTeams();
 
@@ -54,13 +124,10 @@ public:
     const TArray<FTeam>& GetTeams() const;
 
     /**
-     * @brief Gets the array of active teams.
+     * @brief Gets the indices of the active teams that have no eliminated
+     * players.
      */
-    TArray<FTeam> GetActiveTeams() const;
-
-    TArray<FTeam> GetActiveTeamsWithPlayersLeft() const;
-
-    TArray<FTeam> GetActiveTeamsWithNoEliminatedPlayers() const;
+    TArray<ETeamIndex> GetActiveTeamsWithNoEliminatedPlayers() const;
 
     /**
      * @brief Moves the player from their previous team to the specified team.
@@ -69,18 +136,97 @@ public:
      */
     void SwitchPlayerToTeam(ATDPlayerState* Player, const ETeamIndex TeamIndex);
 
+    /**
+     * @brief Removes the player from whichever team they're on, e.g. when they
+     * leave the game.
+     */
+    void RemovePlayer(ATDPlayerState* Player);
+
 private:
     /**
-     * @brief Array of all FTeams.
+     * @brief Updates the team counters after a player is eliminated or
+     * un-eliminated. @see ATDPlayerState::SetIsEliminated
+     */
+    void HandlePlayerEliminated(const FTDPlayerEliminatedEvent& Event);
+
+    /**
+     * @brief Array of all FTeams. Not replicated directly; clients rebuild it
+     * from TeamMemberships.
      */
-    UPROPERTY(ReplicatedUsing=OnRep_Teams, VisibleInstanceOnly)
+    UPROPERTY(VisibleInstanceOnly)
     TArray<FTeam> Teams;
 
     /**
-     * @brief Sets the UIGameState's teams.
+     * @brief Every player's team membership. Push based; only change it
+     * through SetTeamMembership and RemoveTeamMembership.
+     */
+    UPROPERTY(Replicated)
+    FTeamMemberships TeamMemberships;
+
+    /**
+     * @brief Incremented only when a player joins, leaves or switches a team,
+     * so that listeners that are notified without the roster changing (e.g. a
+     * player switching to the team they're on) skip copying the teams.
+     */
+    uint32 TeamsVersion = 0;
+
+    /**
+     * @brief Adds or updates the player's membership so it replicates.
+     */
+    void SetTeamMembership(ATDPlayerState* Player, const ETeamIndex TeamIndex);
+
+    /**
+     * @brief Removes the player's membership so it replicates.
+     */
+    void RemoveTeamMembership(const ATDPlayerState* Player);
+
+    /**
+     * @brief Marks the membership dirty in the fast array and marks
+     * TeamMemberships dirty for push model replication.
+     */
+    void MarkTeamMembershipDirty(FTeamMembership& Membership);
+
+    /**
+     * @brief Moves the membership's player to the membership's team on
+     * clients and sets the UIGameState's teams.
+     */
+    void HandleTeamMembershipChanged(const FTeamMembership& Membership);
+
+    /**
+     * @brief Removes the membership's player from all teams on clients and
+     * sets the UIGameState's teams.
+     */
+    void HandleTeamMembershipRemoved(const FTeamMembership& Membership);
+
+#pragma endregion
+
+#pragma region Team Counters
+
+private:
+    /**
+     * @brief The number of players on each team, indexed by ETeamIndex. Only
+     * maintained on the server.
+     */
+    TArray<uint8> TeamPlayerCounts;
+
+    /**
+     * @brief The number of players on each team that haven't been eliminated,
+     * indexed by ETeamIndex. Only maintained on the server.
+     */
+    TArray<uint8> TeamPlayersLeftCounts;
+
+    /**
+     * @brief Adds (or removes) the player to the counters of the team.
+     * @param Delta 1 if the player joined the team, -1 if they left.
+     */
+    void UpdateTeamCounters(const ETeamIndex TeamIndex,
+        const ATDPlayerState* Player, const int8 Delta);
+
+    /**
+     * @brief Recounts every team and asserts that the counters match. Does
+     * nothing in shipping builds.
      */
-    UFUNCTION()
-    void OnRep_Teams();
+    void CheckTeamCounters() const;
 
 #pragma endregion
 
@@ -125,12 +271,12 @@ public:
     /**
      * @brief Check for whether the provided team has players left.
      */
-    bool DoesTeamHavePlayersLeft(const FTeam& Team) const;
+    bool DoesTeamHavePlayersLeft(const ETeamIndex TeamIndex) const;
 
     /**
      * @brief Check for whether the provided team has no eliminated players.
      */
-    bool DoesTeamHaveNoEliminatedPlayers(const FTeam& Team) const;
+    bool DoesTeamHaveNoEliminatedPlayers(const ETeamIndex TeamIndex) const;
 
     /**
      * @brief Check for whether there's one or no teams with players left.
@@ -141,4 +287,5 @@ public:
 
     friend class ATDGameState;
     friend class ADebugGameStateHUD;
+    friend struct FTeamMembership;
 };
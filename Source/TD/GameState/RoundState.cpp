@@ -2,8 +2,12 @@
 
 #include "RoundState.h"
 
+#include "GameConfiguration.h"
+#include "TDEventBus.h"
 #include "GameModes/RoundStateMachine.h"
+#include "TDGameState.h"
 #include "UIGameState.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
 
 DEFINE_LOG_CATEGORY(LogTDRS);
@@ -19,63 +23,117 @@ void URoundState::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(URoundState, RoundState);
-    DOREPLIFETIME(URoundState, SecondsUntilRoundStarts);
-    DOREPLIFETIME(URoundState, SecondsUntilNextRoundStarts);
-    DOREPLIFETIME(URoundState, OvertimeSecondsPassed);
+    DOREPLIFETIME(URoundState, MatchRoundState);
+    DOREPLIFETIME(URoundState, RoundStartTimer);
+    DOREPLIFETIME(URoundState, NextRoundTimer);
+    DOREPLIFETIME(URoundState, OvertimeTimer);
 }
 
 #pragma region Round State
 
-void URoundState::MatchTick(float DeltaSeconds)
+void URoundState::UpdateUITimers(const float ServerTime) const
 {
-    if (ShouldStartRoundTimerTick)
+    if (RoundStartTimer.IsRunning)
     {
-        SecondsUntilRoundStarts -= DeltaSeconds;
-        UIGameState->SetSecondsUntilRoundStarts(SecondsUntilRoundStarts);
+        UIGameState->SetSecondsUntilRoundStarts(
+            RoundStartTimer.GetSeconds(ServerTime));
     }
-    SecondsUntilNextRoundStarts -= ShouldEndOfRoundTimerTick
-                                       ? DeltaSeconds
-                                       : 0;
-    if (ShouldOvertimeTimerTick)
+    if (OvertimeTimer.IsRunning)
     {
-        OvertimeSecondsPassed += DeltaSeconds;
-        UIGameState->SetMatchTimeInSeconds(OvertimeSecondsPassed);
+        UIGameState->SetMatchTimeInSeconds(
+            OvertimeTimer.GetSeconds(ServerTime));
     }
 }
 
-void URoundState::SetRoundState(FName NewState)
+float URoundState::GetServerWorldTimeSeconds() const
+{
+    const AGameStateBase* GameState = GetOwner<AGameStateBase>();
+    return GameState != nullptr ? GameState->GetServerWorldTimeSeconds() : 0.0f;
+}
+
+const FMatchRoundState& URoundState::GetMatchRoundState() const
+{
+    return MatchRoundState;
+}
+
+void URoundState::SetRoundPhase(const ERoundPhase NewPhase)
 {
     if (GetOwnerRole() == ROLE_Authority)
     {
         UE_LOG(LogTDRS, Log, TEXT("Round State Changed from %s to %s"),
-            *RoundState.ToString(), *NewState.ToString())
-        RoundState = NewState;
+            *RoundState::FromPhase(MatchRoundState.RoundPhase).ToString(),
+            *RoundState::FromPhase(NewPhase).ToString())
+        MatchRoundState.SetRoundPhase(NewPhase);
+        if (NewPhase == ERoundPhase::RoundInProgress)
+        {
+            MatchRoundState.RoundNumber += 1;
+        }
 
         // So callbacks happen on the server too.
-        OnRep_RoundState();
+        OnRep_MatchRoundState();
+    }
+}
+
+void URoundState::SetMatchPhase(const EMatchPhase NewPhase)
+{
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        MatchRoundState.SetMatchPhase(NewPhase);
+        if (NewPhase == EMatchPhase::WaitingToStart)
+        {
+            MatchRoundState.RoundNumber = 0;
+        }
+        OnRep_MatchRoundState();
     }
 }
 
-void URoundState::OnRep_RoundState()
+void URoundState::OnRep_MatchRoundState()
 {
-    if (RoundState == RoundState::WaitingPreRound)
+    FTDPhaseChangedEvent Event;
+    Event.OldMatchPhase = HandledMatchPhase;
+    Event.MatchPhase = MatchRoundState.MatchPhase;
+    Event.OldRoundPhase = HandledRoundPhase;
+    Event.RoundPhase = MatchRoundState.RoundPhase;
+    Event.RoundNumber = MatchRoundState.RoundNumber;
+    if (Event.OldMatchPhase == Event.MatchPhase &&
+        Event.OldRoundPhase == Event.RoundPhase)
     {
-        HandleRoundIsWaitingToStart();
+        return;
     }
-    else if (RoundState == RoundState::RoundInProgress)
+    HandledMatchPhase = Event.MatchPhase;
+    HandledRoundPhase = Event.RoundPhase;
+
+    if (Event.OldRoundPhase != Event.RoundPhase)
     {
-        HandleRoundHasStarted();
+        switch (Event.RoundPhase)
+        {
+        case ERoundPhase::WaitingPreRound:
+            HandleRoundIsWaitingToStart();
+            break;
+        case ERoundPhase::RoundInProgress:
+            HandleRoundHasStarted();
+            break;
+        case ERoundPhase::RoundInOvertime:
+            HandleOvertimeHasStarted();
+            break;
+        case ERoundPhase::WaitingPostRound:
+            HandleRoundHasEnded();
+            break;
+        default:
+            break;
+        }
     }
-    else if (RoundState == RoundState::RoundInOvertime)
+
+    ATDGameState* TDGameState = GetOwner<ATDGameState>();
+    if (TDGameState == nullptr)
     {
-        HandleOvertimeHasStarted();
+        LogInvalidPointer("URoundState", "OnRep_MatchRoundState",
+            "TDGameState");
     }
-    else if (RoundState == RoundState::WaitingPostRound)
+    else
     {
-        HandleRoundHasEnded();
+        TDGameState->GetEventBus().Broadcast(Event);
     }
-    UIGameState->SetRoundState(RoundState);
 }
 
 #pragma region Pre Round
@@ -84,17 +142,11 @@ void URoundState::HandleRoundIsWaitingToStart()
 {
     if (GetOwnerRole() == ROLE_Authority)
     {
-        SecondsUntilRoundStarts = StateMachine->GetRoundStartDelayInSeconds();
+        const float ServerTime = GetServerWorldTimeSeconds();
+        RoundStartTimer.Reset(StateMachine->GetRoundStartDelayInSeconds());
+        RoundStartTimer.Start(ServerTime);
+        NextRoundTimer.Pause(ServerTime);
     }
-    ShouldStartRoundTimerTick = true;
-    ShouldEndOfRoundTimerTick = false;
-    ShouldMatchTimerTick = false;
-    RoundIsWaitingToStartEvent.Broadcast();
-}
-
-bool URoundState::IsThereRoundStartDelayLeft() const
-{
-    return SecondsUntilRoundStarts > 0.0f;
 }
 
 #pragma endregion
@@ -103,9 +155,10 @@ bool URoundState::IsThereRoundStartDelayLeft() const
 
 void URoundState::HandleRoundHasStarted()
 {
-    ShouldMatchTimerTick = true;
-    ShouldStartRoundTimerTick = false;
-    RoundHasStartedEvent.Broadcast();
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        RoundStartTimer.Pause(GetServerWorldTimeSeconds());
+    }
 }
 
 #pragma endregion
@@ -116,17 +169,9 @@ void URoundState::HandleRoundHasEnded()
 {
     if (GetOwnerRole() == ROLE_Authority)
     {
-        SecondsUntilNextRoundStarts = StateMachine->
-            GetEndOfRoundDelayInSeconds();
+        NextRoundTimer.Reset(StateMachine->GetEndOfRoundDelayInSeconds());
+        NextRoundTimer.Start(GetServerWorldTimeSeconds());
     }
-    ShouldMatchTimerTick = false;
-    ShouldEndOfRoundTimerTick = true;
-    RoundHasEndedEvent.Broadcast();
-}
-
-bool URoundState::IsThereEndOfRoundDelayLeft() const
-{
-    return SecondsUntilNextRoundStarts > 0.0f;
 }
 
 #pragma endregion
@@ -135,9 +180,13 @@ bool URoundState::IsThereEndOfRoundDelayLeft() const
 
 void URoundState::HandleOvertimeHasStarted()
 {
-    ShouldOvertimeTimerTick = true;
-    ShouldStartRoundTimerTick = false;
-    OvertimeHasStartedEvent.Broadcast();
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        const float ServerTime = GetServerWorldTimeSeconds();
+        RoundStartTimer.Pause(ServerTime);
+        OvertimeTimer.Reset(0.0f);
+        OvertimeTimer.Start(ServerTime);
+    }
 }
 
 #pragma endregion
@@ -146,8 +195,20 @@ void URoundState::HandleOvertimeHasStarted()
 
 void URoundState::HandleMatchHasEnded()
 {
-    ShouldMatchTimerTick = false;
-    ShouldOvertimeTimerTick = false;
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        OvertimeTimer.Pause(GetServerWorldTimeSeconds());
+    }
+}
+
+void URoundState::HandleMatchIsWaitingToStart()
+{
+    if (GetOwnerRole() == ROLE_Authority)
+    {
+        RoundStartTimer.Reset(0.0f);
+        NextRoundTimer.Reset(0.0f);
+        OvertimeTimer.Reset(0.0f);
+    }
 }
 
 #pragma endregion
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "TDTypes.h"
 #include "Components/ActorComponent.h"
 #include "RoundState.generated.h"
 
@@ -44,45 +45,56 @@ private:
 
 public:
     /**
-     * @brief Tick is called by GameState for consistent ticks.
+     * @brief Called by the GameState each frame on clients to update the UI's
+     * round timers from the synchronized server clock.
+     * @param ServerTime The current server world time.
      */
-    void MatchTick(float DeltaSeconds);
+    void UpdateUITimers(const float ServerTime) const;
 
     /**
-     * @brief Called by the game mode to set the round state. Calls appropriate
-     * callbacks.
-     * @param NewState The new round state to switch to.
+     * @brief Gets the replicated match and round phases.
      */
-    void SetRoundState(FName NewState);
+    const FMatchRoundState& GetMatchRoundState() const;
 
-private:
     /**
-     * @brief The current round state. Usually one of WaitingPreRound,
-     * RoundInProgress, or WaitingPostRound, but is None until the match starts.
+     * @brief Called by the game mode to set the round phase. Calls appropriate
+     * callbacks.
+     * @param NewPhase The new round phase to switch to.
      */
-    UPROPERTY(Transient, VisibleInstanceOnly, ReplicatedUsing=OnRep_RoundState)
-    FName RoundState;
+    void SetRoundPhase(const ERoundPhase NewPhase);
 
     /**
-     * @brief Calls the appropriate callbacks for the new round state.
+     * @brief Called by the game state to set the match phase so it replicates
+     * along with the round phase. Publishes FTDPhaseChangedEvent.
+     * @param NewPhase The new match phase.
      */
-    UFUNCTION()
-    void OnRep_RoundState();
+    void SetMatchPhase(const EMatchPhase NewPhase);
 
-#pragma region Pre Round
-
-    DECLARE_EVENT(URoundStateMachine, FRoundIsWaitingToStartEvent);
+private:
+    /**
+     * @brief The current match and round phases. The round phase is usually
+     * one of WaitingPreRound, RoundInProgress, RoundInOvertime, or
+     * WaitingPostRound, but is None until the match starts.
+     */
+    UPROPERTY(Transient, VisibleInstanceOnly,
+        ReplicatedUsing=OnRep_MatchRoundState)
+    FMatchRoundState MatchRoundState;
 
-public:
     /**
-     * @brief Event for when round state has been set to WaitingPreRound.
+     * @brief The phases that callbacks were last called for, since the round
+     * number replicates in the same struct.
      */
-    FRoundIsWaitingToStartEvent RoundIsWaitingToStartEvent;
+    EMatchPhase HandledMatchPhase = EMatchPhase::None;
+    ERoundPhase HandledRoundPhase = ERoundPhase::None;
 
     /**
-     * @brief Check for whether the round start should still delay.
+     * @brief Calls the appropriate callbacks if the round phase changed and
+     * publishes FTDPhaseChangedEvent if either phase changed.
      */
-    bool IsThereRoundStartDelayLeft() const;
+    UFUNCTION()
+    void OnRep_MatchRoundState();
+
+#pragma region Pre Round
 
 protected:
     /**
@@ -95,31 +107,13 @@ private:
      * @brief How long to wait until the round starts.
      */
     UPROPERTY(VisibleInstanceOnly, Replicated)
-    float SecondsUntilRoundStarts = 0.0f;
-
-    /**
-     * @brief Whether the round start timer should tick.
-     */
-    bool ShouldStartRoundTimerTick = false;
+    FReplicatedTimer RoundStartTimer;
 
 #pragma endregion
 
 #pragma region Round In Progress
 
-    DECLARE_EVENT(URoundStateMachine, FRoundHasStartedEvent);
-
-public:
-    /**
-     * @brief Event for when round state has been set to RoundInProgress.
-     */
-    FRoundHasStartedEvent RoundHasStartedEvent;
-
 private:
-    /**
-     * @brief Whether the match timer should tick.
-     */
-    bool ShouldMatchTimerTick = false;
-
     /**
      * @brief Callback for when round state has been set to RoundInProgress.
      */
@@ -129,19 +123,6 @@ private:
 
 #pragma region Post Round
 
-    DECLARE_EVENT(URoundStateMachine, FRoundHasEndedEvent);
-
-public:
-    /**
-     * @brief Event for when round state has been set to WaitingPostRound.
-     */
-    FRoundHasEndedEvent RoundHasEndedEvent;
-
-    /**
-     * @brief Check for whether the round end should still delay.
-     */
-    bool IsThereEndOfRoundDelayLeft() const;
-
 protected:
     /**
      * @brief Callback for when round state has been set to WaitingPostRound.
@@ -153,36 +134,18 @@ private:
      * @brief How long to wait until advancing to the next (pre) round.
      */
     UPROPERTY(VisibleInstanceOnly, Replicated)
-    float SecondsUntilNextRoundStarts = 0.0f;
-
-    /**
-     * @brief Whether the end of round timer should tick.
-     */
-    bool ShouldEndOfRoundTimerTick = false;
+    FReplicatedTimer NextRoundTimer;
 
 #pragma endregion
 
 #pragma region Overtime
 
-    DECLARE_EVENT(URoundStateMachine, FOvertimeHasStartedEvent);
-
-public:
-    /**
-     * @brief Set when round state has been set to RoundInOvertime.
-     */
-    FOvertimeHasStartedEvent OvertimeHasStartedEvent;
-
 private:
     /**
      * @brief How long overtime has lasted.
      */
     UPROPERTY(VisibleInstanceOnly, Replicated)
-    float OvertimeSecondsPassed = 0;
-
-    /**
-     * @brief Whether the overtime timer should tick.
-     */
-    bool ShouldOvertimeTimerTick = false;
+    FReplicatedTimer OvertimeTimer = FReplicatedTimer(true);
 
     /**
      * @brief Callback for when round state has been set to RoundInOvertime.
@@ -194,8 +157,19 @@ private:
      */
     void HandleMatchHasEnded();
 
+    /**
+     * @brief Callback for when the match is waiting to start (again). Resets
+     * the round timers.
+     */
+    void HandleMatchIsWaitingToStart();
+
 #pragma endregion
 
+    /**
+     * @brief Gets the server world time from the game state.
+     */
+    float GetServerWorldTimeSeconds() const;
+
 #pragma endregion
 
     /**
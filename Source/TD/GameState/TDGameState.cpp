@@ -6,22 +6,60 @@
 #include "UIGameState.h"
 #include "RoundState.h"
 #include "TDGameInstance.h"
+#include "Components/CueState.h"
 #include "Components/OrbState.h"
 #include "Components/TeamState.h"
 #include "Components/ScoreState.h"
 #include "GameModes/TDGameMode.h"
 #include "Orb/Orb.h"
+#include "Player/TDPlayerState.h"
 
 #include "Net/UnrealNetwork.h"
 
 DEFINE_LOG_CATEGORY(LogTDGS);
 
+/**
+ * @brief Converts one of the MatchState names to its EMatchPhase.
+ */
+static EMatchPhase ToMatchPhase(const FName& State)
+{
+    if (State == MatchState::EnteringMap)
+    {
+        return EMatchPhase::EnteringMap;
+    }
+    if (State == MatchState::WaitingToStart)
+    {
+        return EMatchPhase::WaitingToStart;
+    }
+    if (State == MatchState::InProgress)
+    {
+        return EMatchPhase::InProgress;
+    }
+    if (State == MatchState::WaitingPostMatch)
+    {
+        return EMatchPhase::WaitingPostMatch;
+    }
+    if (State == MatchState::LeavingMap)
+    {
+        return EMatchPhase::LeavingMap;
+    }
+    if (State == MatchState::Aborted)
+    {
+        return EMatchPhase::Aborted;
+    }
+    return EMatchPhase::None;
+}
+
 #pragma region Initialization
 
 ATDGameState::ATDGameState()
 {
     PrimaryActorTick.bCanEverTick = true;
 
+    // Replicated ahead of other actors to joining players, since the phase,
+    // timers, scores and teams are needed to play.
+    NetPriority = 5.0f;
+
     UIGameState = CreateDefaultSubobject<UUIGameState>(TEXT("UI Game State"));
     RoundStateComponent = CreateDefaultSubobject<URoundState>(
         TEXT("Round State"));
@@ -38,6 +76,7 @@ void ATDGameState::CreateStateComponents()
     ScoreStateComponent = CreateDefaultSubobject<UScoreState>(
         TEXT("Score State"));
     OrbStateComponent = CreateDefaultSubobject<UOrbState>(TEXT("Orb State"));
+    CueStateComponent = CreateDefaultSubobject<UCueState>(TEXT("Cue State"));
 }
 
 void ATDGameState::AddStateComponents()
@@ -45,6 +84,7 @@ void ATDGameState::AddStateComponents()
     StateComponents.Emplace(TeamStateComponent);
     StateComponents.Emplace(ScoreStateComponent);
     StateComponents.Emplace(OrbStateComponent);
+    StateComponents.Emplace(CueStateComponent);
 }
 
 void ATDGameState::InitStateComponents()
@@ -59,14 +99,19 @@ void ATDGameState::InitStateComponents()
 void ATDGameState::BeginPlay()
 {
     Super::BeginPlay();
-    RoundStateComponent->RoundIsWaitingToStartEvent.AddUObject(this,
-        &ATDGameState::HandleRoundIsWaitingToStart);
-    RoundStateComponent->RoundHasStartedEvent.AddUObject(this,
-        &ATDGameState::HandleRoundHasStarted);
-    RoundStateComponent->RoundHasEndedEvent.AddUObject(this,
-        &ATDGameState::HandleRoundHasEnded);
-    RoundStateComponent->OvertimeHasStartedEvent.AddUObject(this,
-        &ATDGameState::HandleOvertimeHasStarted);
+    if (GetNetMode() == NM_DedicatedServer)
+    {
+        SetActorTickEnabled(false);
+    }
+
+    EventBus.Subscribe<FTDPhaseChangedEvent, ATDGameState,
+        &ATDGameState::HandlePhaseChanged>(this);
+}
+
+void ATDGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    EventBus.UnsubscribeAll(this);
+    Super::EndPlay(EndPlayReason);
 }
 
 void ATDGameState::ReceivedGameModeClass()
@@ -84,8 +129,8 @@ void ATDGameState::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(ATDGameState, SecondsUntilMatchEnds);
-    DOREPLIFETIME(ATDGameState, SecondsUntilMatchRestarts);
+    DOREPLIFETIME(ATDGameState, MatchTimer);
+    DOREPLIFETIME(ATDGameState, MatchRestartTimer);
 }
 
 URoundState* ATDGameState::GetRoundStateComponent() const
@@ -108,6 +153,47 @@ UOrbState* ATDGameState::GetOrbStateComponent() const
     return OrbStateComponent;
 }
 
+UCueState* ATDGameState::GetCueStateComponent() const
+{
+    return CueStateComponent;
+}
+
+FTDEventBus& ATDGameState::GetEventBus()
+{
+    return EventBus;
+}
+
+FTDJoinSnapshot ATDGameState::MakeJoinSnapshot() const
+{
+    FTDJoinSnapshot Snapshot;
+    Snapshot.MatchRoundState = RoundStateComponent->GetMatchRoundState();
+    Snapshot.MatchTimer = Snapshot.MatchRoundState.IsInOvertime()
+                              ? RoundStateComponent->OvertimeTimer
+                              : MatchTimer;
+    Snapshot.RoundStartTimer = RoundStateComponent->RoundStartTimer;
+    Snapshot.MatchRestartTimer = MatchRestartTimer;
+    Snapshot.Rebase(GetServerWorldTimeSeconds());
+    Snapshot.TeamScores = ScoreStateComponent->TeamScores;
+
+    for (const FTeam& Team : TeamStateComponent->GetTeams())
+    {
+        for (const ATDPlayerState* Player : Team.Players)
+        {
+            if (Player == nullptr)
+            {
+                continue;
+            }
+            FTDJoinSnapshotPlayer& SnapshotPlayer = Snapshot.Players.
+                AddDefaulted_GetRef();
+            SnapshotPlayer.PlayerId = Player->GetPlayerId();
+            SnapshotPlayer.PlayerName = Player->GetPlayerName();
+            SnapshotPlayer.Team = Team.Index;
+            SnapshotPlayer.IsEliminated = Player->GetIsEliminated();
+        }
+    }
+    return Snapshot;
+}
+
 UUIGameState* ATDGameState::GetUIGameState() const
 {
     return UIGameState;
@@ -137,12 +223,10 @@ void ATDGameState::PlayLocalCue(USoundBase* Sound, FVector* Location) const
     }
 }
 
-void ATDGameState::PlayReplicatedCueAtLocation_Implementation(USoundBase* Sound,
-    const FVector& Location)
+void ATDGameState::PlayReplicatedCueAtLocation(USoundBase* Sound,
+    const FVector& Location, AActor* Source) const
 {
-    const FPlayerAudioSettings& AudioSettings = GetAudioSettings();
-    UGameplayStatics::PlaySoundAtLocation(this, Sound, Location,
-        AudioSettings.GameSFXVolume);
+    CueStateComponent->PlayReplicatedCueAtLocation(Sound, Location, Source);
 }
 
 FPlayerAudioSettings ATDGameState::GetAudioSettings() const
@@ -177,23 +261,32 @@ void ATDGameState::SetPlayerRequestResult(const EPlayerRequestResult Result,
 void ATDGameState::Tick(float DeltaSeconds)
 {
     Super::Tick(DeltaSeconds);
-    if (RoundStateComponent->ShouldMatchTimerTick)
+    UpdateUITimers();
+}
+
+void ATDGameState::UpdateUITimers() const
+{
+    const float ServerTime = GetServerWorldTimeSeconds();
+    if (MatchTimer.IsRunning)
     {
-        SecondsUntilMatchEnds -= DeltaSeconds;
-        UIGameState->SetMatchTimeInSeconds(SecondsUntilMatchEnds);
+        UIGameState->SetMatchTimeInSeconds(MatchTimer.GetSeconds(ServerTime));
     }
 
-    RoundStateComponent->MatchTick(DeltaSeconds);
+    RoundStateComponent->UpdateUITimers(ServerTime);
 
-    if (ShouldRestartMatchTimerTick)
+    if (MatchRestartTimer.IsRunning)
     {
-        SecondsUntilMatchRestarts -= DeltaSeconds;
-        UIGameState->SetSecondsUntilMatchRestarts(SecondsUntilMatchRestarts);
+        UIGameState->SetSecondsUntilMatchRestarts(
+            MatchRestartTimer.GetSeconds(ServerTime));
     }
 }
 
 void ATDGameState::OnRep_MatchState()
 {
+    if (HasAuthority())
+    {
+        RoundStateComponent->SetMatchPhase(ToMatchPhase(MatchState));
+    }
     Super::OnRep_MatchState();
     UIGameState->SetMatchState(MatchState);
 }
@@ -205,8 +298,10 @@ void ATDGameState::HandleMatchIsWaitingToStart()
     Super::HandleMatchIsWaitingToStart();
     if (HasAuthority())
     {
-        SecondsUntilMatchEnds = TDGameMode->GetMatchLengthInSeconds();
+        MatchTimer.Reset(TDGameMode->GetMatchLengthInSeconds());
+        MatchRestartTimer.Reset(0.0f);
     }
+    RoundStateComponent->HandleMatchIsWaitingToStart();
 
     for (UTDGameStateComponent* Component : StateComponents)
     {
@@ -221,7 +316,8 @@ void ATDGameState::HandleMatchIsWaitingToStart()
 void ATDGameState::HandleMatchHasStarted()
 {
     Super::HandleMatchHasStarted();
-    UIGameState->SetMatchTimeInSeconds(SecondsUntilMatchEnds);
+    UIGameState->SetMatchTimeInSeconds(
+        MatchTimer.GetSeconds(GetServerWorldTimeSeconds()));
 
     for (UTDGameStateComponent* Component : StateComponents)
     {
@@ -229,25 +325,48 @@ void ATDGameState::HandleMatchHasStarted()
     }
 }
 
-bool ATDGameState::IsThereMatchTimeLeft() const
+#pragma region Round State
+
+void ATDGameState::HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
 {
-    return SecondsUntilMatchEnds > 0.0f;
+    if (Event.OldRoundPhase == Event.RoundPhase)
+    {
+        return;
+    }
+
+    switch (Event.RoundPhase)
+    {
+    case ERoundPhase::WaitingPreRound:
+        HandleRoundIsWaitingToStart();
+        break;
+    case ERoundPhase::RoundInProgress:
+        HandleRoundHasStarted();
+        break;
+    case ERoundPhase::WaitingPostRound:
+        HandleRoundHasEnded();
+        break;
+    default:
+        break;
+    }
 }
 
-#pragma region Round State
+ERoundPhase ATDGameState::GetRoundPhase() const
+{
+    return RoundStateComponent->GetMatchRoundState().RoundPhase;
+}
 
-FName ATDGameState::GetRoundState() const
+bool ATDGameState::IsInPlay() const
 {
-    return RoundStateComponent->RoundState;
+    return RoundStateComponent->GetMatchRoundState().IsInPlay;
 }
 
 #pragma region Pre Round
 
 void ATDGameState::HandleRoundIsWaitingToStart()
 {
-    for (UTDGameStateComponent* Component : StateComponents)
+    if (HasAuthority())
     {
-        Component->HandleRoundIsWaitingToStart();
+        MatchTimer.Pause(GetServerWorldTimeSeconds());
     }
 }
 
@@ -257,9 +376,9 @@ void ATDGameState::HandleRoundIsWaitingToStart()
 
 void ATDGameState::HandleRoundHasStarted()
 {
-    for (UTDGameStateComponent* Component : StateComponents)
+    if (HasAuthority())
     {
-        Component->HandleRoundHasStarted();
+        MatchTimer.Start(GetServerWorldTimeSeconds());
     }
 }
 
@@ -269,21 +388,9 @@ void ATDGameState::HandleRoundHasStarted()
 
 void ATDGameState::HandleRoundHasEnded()
 {
-    for (UTDGameStateComponent* Component : StateComponents)
-    {
-        Component->HandleRoundHasEnded();
-    }
-}
-
-#pragma endregion
-
-#pragma region Overtime
-
-void ATDGameState::HandleOvertimeHasStarted()
-{
-    for (UTDGameStateComponent* Component : StateComponents)
+    if (HasAuthority())
     {
-        Component->HandleOvertimeHasStarted();
+        MatchTimer.Pause(GetServerWorldTimeSeconds());
     }
 }
 
@@ -295,11 +402,6 @@ void ATDGameState::HandleOvertimeHasStarted()
 
 #pragma region Post Match
 
-bool ATDGameState::IsThereMatchRestartDelayLeft() const
-{
-    return SecondsUntilMatchRestarts > 0.0f;
-}
-
 void ATDGameState::NotifyOvertimeHasEnded()
 {
     HandleOvertimeHasEnded();
@@ -319,9 +421,11 @@ void ATDGameState::HandleMatchHasEnded()
     RoundStateComponent->HandleMatchHasEnded();
     if (HasAuthority())
     {
-        SecondsUntilMatchRestarts = TDGameMode->GetMatchRestartDelayInSeconds();
+        const float ServerTime = GetServerWorldTimeSeconds();
+        MatchTimer.Pause(ServerTime);
+        MatchRestartTimer.Reset(TDGameMode->GetMatchRestartDelayInSeconds());
+        MatchRestartTimer.Start(ServerTime);
     }
-    ShouldRestartMatchTimerTick = true;
 
     for (UTDGameStateComponent* Component : StateComponents)
     {
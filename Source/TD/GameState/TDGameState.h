@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 
+#include "TDEventBus.h"
+#include "TDJoinSnapshot.h"
 #include "Components/TDGameStateComponent.h"
 #include "UIGameState.h"
 #include "GameFramework/GameState.h"
@@ -11,6 +13,7 @@
 #include "TDGameState.generated.h"
 
 class AOrb;
+class UCueState;
 class UOrbState;
 class UTeamState;
 class UScoreState;
@@ -52,10 +55,12 @@ public:
     void InitStateComponents();
 
     /**
-     * @brief Binds to round state events.
+     * @brief Subscribes to phase changes.
      */
     virtual void BeginPlay() override;
 
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
      * @brief Initializes the game mode.
      */
@@ -85,6 +90,22 @@ public:
      */
     UOrbState* GetOrbStateComponent() const;
 
+    /**
+     * @brief Gets the component that replicates sound cues.
+     */
+    UCueState* GetCueStateComponent() const;
+
+    /**
+     * @brief Gets the bus that TD gameplay events are published on.
+     */
+    FTDEventBus& GetEventBus();
+
+    /**
+     * @brief Takes a snapshot of the state that a player joining the match in
+     * progress needs to play. Only valid on the server.
+     */
+    FTDJoinSnapshot MakeJoinSnapshot() const;
+
 private:
     /**
      * @brief The game mode has match configuration information.
@@ -117,21 +138,45 @@ private:
     UOrbState* OrbStateComponent = nullptr;
 
     /**
-     * @brief Array of all UTDGameStateComponents that are listening for
-     * various match and round state events.
+     * @brief Component that replicates sound cues.
+     */
+    UPROPERTY(VisibleAnywhere)
+    UCueState* CueStateComponent = nullptr;
+
+    /**
+     * @brief Array of all UTDGameStateComponents that are listening for match
+     * state events.
      */
     UPROPERTY()
     TArray<UTDGameStateComponent*> StateComponents;
 
+    /**
+     * @brief The bus that TD gameplay events are published on.
+     */
+    FTDEventBus EventBus;
+
 #pragma endregion
 
 #pragma region Match State
 
+public:
+    /**
+     * @brief Updates the UI's match and round timers from the synchronized
+     * server clock.
+     */
+    void UpdateUITimers() const;
+
 protected:
     /**
-     * @brief Ticks various timers.
+     * @brief Updates the UI's timers. Only ticks on clients since nothing is
+     * displayed on a dedicated server.
      */
     virtual void Tick(float DeltaSeconds) override;
+
+    /**
+     * @brief Notifies the UI and, on the server, sets the replicated match
+     * phase.
+     */
     virtual void OnRep_MatchState() override;
 
 #pragma region Pre Match
@@ -146,12 +191,6 @@ protected:
 
 #pragma region Match In Progress
 
-public:
-    /**
-     * @brief Check for whether there's match time left.
-     */
-    bool IsThereMatchTimeLeft() const;
-
 protected:
     /**
      * @brief Callback for when match state has been set to InProgress.
@@ -160,18 +199,30 @@ protected:
 
 private:
     /**
-     * @brief How many seconds until the match should end.
+     * @brief How many seconds until the match should end. Only runs while a
+     * round is in progress.
      */
     UPROPERTY(VisibleInstanceOnly, Replicated)
-    float SecondsUntilMatchEnds = 0.0f;
+    FReplicatedTimer MatchTimer;
 
 #pragma region Round State
 
 public:
     /**
-     * @brief Gets the current round state.
+     * @brief Starts and pauses the match timer when the round phase changes.
      */
-    FName GetRoundState() const;
+    void HandlePhaseChanged(const FTDPhaseChangedEvent& Event);
+
+    /**
+     * @brief Gets the current round phase.
+     */
+    ERoundPhase GetRoundPhase() const;
+
+    /**
+     * @brief Whether the match is in progress and a round (or overtime) is
+     * being played. Cached, so it's cheap to call often.
+     */
+    bool IsInPlay() const;
 
 #pragma region Pre Round
 
@@ -179,7 +230,6 @@ private:
     /**
      * @brief Callback for when round state has been set to WaitingPreRound.
      */
-    UFUNCTION()
     void HandleRoundIsWaitingToStart();
 
 #pragma endregion
@@ -190,7 +240,6 @@ private:
     /**
      * @brief Callback for when round state has been set to RoundInProgress.
      */
-    UFUNCTION()
     void HandleRoundHasStarted();
 
 #pragma endregion
@@ -201,22 +250,10 @@ private:
     /**
      * @brief Callback for when round state has been set to WaitingPostRound.
      */
-    UFUNCTION()
     void HandleRoundHasEnded();
 
 #pragma endregion
 
-#pragma region Overtime
-
-private:
-    /**
-     * @brief Callback for when round state has been set to RoundInOvertime.
-     */
-    UFUNCTION()
-    void HandleOvertimeHasStarted();
-
-#pragma endregion
-
 #pragma endregion
 
 #pragma endregion
@@ -224,11 +261,6 @@ private:
 #pragma region Post Match
 
 public:
-    /**
-     * @brief Check for whether the match should still delay restarting.
-     */
-    bool IsThereMatchRestartDelayLeft() const;
-
     /**
      * @brief Called by the TDGameMode to tell this class to call
      * HandleOvertimeHasEnded().
@@ -248,16 +280,11 @@ protected:
     virtual void HandleMatchHasEnded() override;
 
 private:
-    /**
-     * @brief Whether the timer for restarting the match should tick.
-     */
-    bool ShouldRestartMatchTimerTick = false;
-
     /**
      * @brief How much time to wait until restarting the match.
      */
     UPROPERTY(VisibleInstanceOnly, Replicated)
-    float SecondsUntilMatchRestarts = 0.0f;
+    FReplicatedTimer MatchRestartTimer;
 
 #pragma endregion
 
@@ -272,11 +299,13 @@ public:
     void HandleOrbImpact(AOrb* InstigatorOrb, const FHitResult& Hit) const;
 
     void PlayLocalCue(USoundBase* Sound, FVector* Location = nullptr) const;
-    UFUNCTION(NetMulticast, Unreliable)
+
+    /**
+     * @brief Plays the cue for every player close enough to hear it.
+     * @see UCueState::PlayReplicatedCueAtLocation
+     */
     void PlayReplicatedCueAtLocation(USoundBase* Sound,
-        const FVector& Location);
-    void PlayReplicatedCueAtLocation_Implementation(USoundBase* Sound,
-        const FVector& Location);
+        const FVector& Location, AActor* Source = nullptr) const;
 
 private:
     FPlayerAudioSettings GetAudioSettings() const;
@@ -1,8 +1,13 @@
 // Copyright 2021, James S. Wang, All rights reserved.
 
 #include "UIGameState.h"
+#include "GameConfiguration.h"
+#include "TDJoinSnapshot.h"
 #include "GameFramework/GameMode.h"
 #include "GameModes/RoundStateMachine.h"
+#include "GameState/RoundState.h"
+#include "GameState/TDGameState.h"
+#include "Player/TDPlayerState.h"
 
 /**
  * Setter with delegate template.
@@ -10,15 +15,180 @@
 
 void UUIGameState::SetVariableName(VariableType NewVariableName)
 {
-    VariableType OldVariableName = VariableName;
+    if (VariableName == NewVariableName)
+    {
+        return;
+    }
     VariableName = NewVariableName;
-    DelegateName.Broadcast(OldVariableName, NewVariableName);
+    MarkDirty(EUIGameStateField::VariableName);
 }
+
+    And in BroadcastDirtyFields():
+
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::VariableName))
+    {
+        DelegateName.Broadcast(BroadcastVariableName, VariableName);
+        BroadcastVariableName = VariableName;
+    }
  */
 
+#pragma region Initialization
+
+UUIGameState::UUIGameState()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
+    {
+        TeamScores.Emplace(0);
+    }
+    BroadcastTeamScores = TeamScores;
+}
+
+void UUIGameState::BeginPlay()
+{
+    Super::BeginPlay();
+    ATDGameState* TDGameState = GetOwner<ATDGameState>();
+    if (TDGameState == nullptr)
+    {
+        LogInvalidPointer("UUIGameState", "BeginPlay", "TDGameState");
+        return;
+    }
+    FTDEventBus& EventBus = TDGameState->GetEventBus();
+    EventBus.Subscribe<FTDPhaseChangedEvent, UUIGameState,
+        &UUIGameState::HandlePhaseChanged>(this);
+    EventBus.Subscribe<FTDScoreChangedEvent, UUIGameState,
+        &UUIGameState::HandleScoreChanged>(this);
+
+    // The round state's first OnRep can run before this subscribes, e.g. on
+    // a newly replicated game state, so catch up with the current phase.
+    const URoundState* RoundStateComponent =
+        TDGameState->GetRoundStateComponent();
+    if (RoundStateComponent == nullptr)
+    {
+        LogInvalidPointer("UUIGameState", "BeginPlay", "RoundStateComponent");
+        return;
+    }
+    const FMatchRoundState& MatchRoundState =
+        RoundStateComponent->GetMatchRoundState();
+    FTDPhaseChangedEvent Event;
+    Event.OldRoundPhase = RoundPhase;
+    Event.MatchPhase = MatchRoundState.MatchPhase;
+    Event.RoundPhase = MatchRoundState.RoundPhase;
+    Event.RoundNumber = MatchRoundState.RoundNumber;
+    HandlePhaseChanged(Event);
+    TDGameState->UpdateUITimers();
+}
+
+void UUIGameState::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ATDGameState* TDGameState = GetOwner<ATDGameState>();
+    if (TDGameState != nullptr)
+    {
+        TDGameState->GetEventBus().UnsubscribeAll(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+void UUIGameState::TickComponent(float DeltaTime, ELevelTick TickType,
+    FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    BroadcastDirtyFields();
+}
+
+#pragma endregion
+
+#pragma region Batched Broadcasts
+
+void UUIGameState::MarkDirty(const EUIGameStateField Field)
+{
+    // Nothing is bound to the UI on a dedicated server.
+    if (GetNetMode() == NM_DedicatedServer)
+    {
+        return;
+    }
+
+    if (DirtyFields == EUIGameStateField::None)
+    {
+        SetComponentTickEnabled(true);
+    }
+    DirtyFields |= Field;
+}
+
+void UUIGameState::BroadcastDirtyFields()
+{
+    // Clear before broadcasting so that anything set by a listener is
+    // broadcast next frame.
+    const EUIGameStateField Fields = DirtyFields;
+    DirtyFields = EUIGameStateField::None;
+    SetComponentTickEnabled(false);
+
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::Teams))
+    {
+        // BroadcastTeams already holds the old teams. @see SetTeams
+        OnTeamsChanged.Broadcast(BroadcastTeams, Teams);
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::MatchTimeInSeconds))
+    {
+        OnMatchTimeInSecondsUpdated.Broadcast(BroadcastMatchTimeInSeconds,
+            MatchTimeInSeconds);
+        BroadcastMatchTimeInSeconds = MatchTimeInSeconds;
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::SecondsUntilRoundStarts))
+    {
+        OnSecondsUntilRoundStartsUpdated.Broadcast(
+            BroadcastSecondsUntilRoundStarts, SecondsUntilRoundStarts);
+        BroadcastSecondsUntilRoundStarts = SecondsUntilRoundStarts;
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::TeamScores))
+    {
+        OnTeamScoresUpdated.Broadcast(BroadcastTeamScores, TeamScores);
+        BroadcastTeamScores = TeamScores;
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::SecondsUntilMatchRestarts))
+    {
+        OnSecondsUntilMatchRestartsUpdated.Broadcast(
+            BroadcastSecondsUntilMatchRestarts, SecondsUntilMatchRestarts);
+        BroadcastSecondsUntilMatchRestarts = SecondsUntilMatchRestarts;
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::RoundWinningTeams))
+    {
+        OnRoundWinningTeamsUpdated.Broadcast(BroadcastRoundWinningTeams,
+            RoundWinningTeams);
+        BroadcastRoundWinningTeams = RoundWinningTeams;
+    }
+    if (EnumHasAnyFlags(Fields, EUIGameStateField::MatchWinningTeams))
+    {
+        OnMatchWinningTeamsUpdated.Broadcast(BroadcastMatchWinningTeams,
+            MatchWinningTeams);
+        BroadcastMatchWinningTeams = MatchWinningTeams;
+    }
+}
+
+float UUIGameState::QuantizeSeconds(const float Seconds) const
+{
+    if (TimerDisplayGranularityInSeconds <= 0.0f)
+    {
+        return Seconds;
+    }
+    return FMath::CeilToFloat(Seconds / TimerDisplayGranularityInSeconds) *
+           TimerDisplayGranularityInSeconds;
+}
+
+#pragma endregion
+
+#pragma region Setters
+
 void UUIGameState::SetMatchState(const FName& NewMatchState)
 {
-    const FName& OldMatchState = MatchState;
+    if (MatchState == NewMatchState)
+    {
+        return;
+    }
+    const FName OldMatchState = MatchState;
     MatchState = NewMatchState;
     OnMatchStateUpdated.Broadcast(OldMatchState, NewMatchState);
     BroadcastNewMatchState();
@@ -36,44 +206,71 @@ void UUIGameState::BroadcastNewMatchState() const
     }
 }
 
-void UUIGameState::SetRoundState(const FName& NewRoundState)
+void UUIGameState::HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
 {
-    const FName& OldRoundState = RoundState;
-    RoundState = NewRoundState;
-    OnRoundStateUpdated.Broadcast(OldRoundState, NewRoundState);
+    SetRoundState(Event.RoundPhase);
+}
+
+void UUIGameState::SetRoundState(const ERoundPhase NewRoundPhase)
+{
+    if (RoundPhase == NewRoundPhase)
+    {
+        return;
+    }
+    const FName OldRoundState = RoundState;
+    RoundPhase = NewRoundPhase;
+    RoundState = RoundState::FromPhase(NewRoundPhase);
+    OnRoundStateUpdated.Broadcast(OldRoundState, RoundState);
     BroadcastNewRoundState();
 }
 
 void UUIGameState::BroadcastNewRoundState() const
 {
-    if (RoundState == RoundState::WaitingPreRound)
+    switch (RoundPhase)
     {
+    case ERoundPhase::WaitingPreRound:
         OnRoundIsWaitingToStart.Broadcast();
-    }
-    else if (RoundState == RoundState::RoundInProgress)
-    {
+        break;
+    case ERoundPhase::RoundInProgress:
         OnRoundStarted.Broadcast();
-    }
-    else if (RoundState == RoundState::WaitingPostRound)
-    {
+        break;
+    case ERoundPhase::WaitingPostRound:
         OnRoundEnded.Broadcast();
-    }
-    else if (RoundState == RoundState::RoundInOvertime)
-    {
+        break;
+    case ERoundPhase::RoundInOvertime:
         OnOvertimeStarted.Broadcast();
+        break;
+    default:
+        break;
     }
 }
 
-void UUIGameState::SetTeams(const TArray<FTeam>& NewTeams)
+void UUIGameState::SetTeams(const TArray<FTeam>& NewTeams,
+    const uint32 NewTeamsVersion)
 {
-    const TArray<FTeam>& OldTeams = Teams;
+    // Nothing is bound to the UI on a dedicated server, so the teams aren't
+    // worth copying. Version 0 is the team state before anyone has joined,
+    // which would only replace the join snapshot's teams with empty ones.
+    if (GetNetMode() == NM_DedicatedServer || NewTeamsVersion == 0 ||
+        TeamsVersion == NewTeamsVersion)
+    {
+        return;
+    }
+    TeamsVersion = NewTeamsVersion;
+
+    // The teams that were last broadcast are moved rather than copied into
+    // the old value, unless they changed again before being broadcast.
+    if (!EnumHasAnyFlags(DirtyFields, EUIGameStateField::Teams))
+    {
+        BroadcastTeams = MoveTemp(Teams);
+    }
     Teams = NewTeams;
-    OnTeamsChanged.Broadcast(OldTeams, NewTeams);
+    MarkDirty(EUIGameStateField::Teams);
 }
 
 void UUIGameState::SetPlayerRequest(const FPlayerRequest& NewPlayerRequest)
 {
-    const FPlayerRequest& OldPlayerRequest = PlayerRequest;
+    const FPlayerRequest OldPlayerRequest = PlayerRequest;
     PlayerRequest = NewPlayerRequest;
     OnPlayerRequestCompleted.Broadcast(OldPlayerRequest, NewPlayerRequest);
 }
@@ -81,55 +278,183 @@ void UUIGameState::SetPlayerRequest(const FPlayerRequest& NewPlayerRequest)
 void UUIGameState::SetMatchTimeInSeconds(
     const float NewSecondsUntilMatchEnds)
 {
-    float OldSecondsUntilMatchEnds = MatchTimeInSeconds;
-    MatchTimeInSeconds = NewSecondsUntilMatchEnds;
-    OnMatchTimeInSecondsUpdated.Broadcast(OldSecondsUntilMatchEnds,
-        NewSecondsUntilMatchEnds);
+    UpdatedFields |= EUIGameStateField::MatchTimeInSeconds;
+    const float DisplayedSeconds = QuantizeSeconds(NewSecondsUntilMatchEnds);
+    if (MatchTimeInSeconds == DisplayedSeconds)
+    {
+        return;
+    }
+    MatchTimeInSeconds = DisplayedSeconds;
+    MarkDirty(EUIGameStateField::MatchTimeInSeconds);
 }
 
 void UUIGameState::SetSecondsUntilRoundStarts(
     const float NewSecondsUntilRoundStarts)
 {
-    const float OldSecondsUntilRoundStarts = SecondsUntilRoundStarts;
-    SecondsUntilRoundStarts = NewSecondsUntilRoundStarts;
-    OnSecondsUntilRoundStartsUpdated.Broadcast(OldSecondsUntilRoundStarts,
-        NewSecondsUntilRoundStarts);
+    UpdatedFields |= EUIGameStateField::SecondsUntilRoundStarts;
+    const float DisplayedSeconds = QuantizeSeconds(NewSecondsUntilRoundStarts);
+    if (SecondsUntilRoundStarts == DisplayedSeconds)
+    {
+        return;
+    }
+    SecondsUntilRoundStarts = DisplayedSeconds;
+    MarkDirty(EUIGameStateField::SecondsUntilRoundStarts);
 }
 
 void UUIGameState::SetTeamScores(const TArray<uint8>& NewTeamScores)
 {
-    const TArray<uint8>& OldTeamScores = TeamScores;
+    UpdatedFields |= EUIGameStateField::TeamScores;
+    if (TeamScores == NewTeamScores)
+    {
+        return;
+    }
     TeamScores = NewTeamScores;
-    OnTeamScoresUpdated.Broadcast(OldTeamScores, NewTeamScores);
+    MarkDirty(EUIGameStateField::TeamScores);
+}
+
+void UUIGameState::HandleScoreChanged(const FTDScoreChangedEvent& Event)
+{
+    UpdatedFields |= EUIGameStateField::TeamScores;
+    const int32 Index = Int(Event.Team);
+    if (!TeamScores.IsValidIndex(Index) || TeamScores[Index] == Event.Score)
+    {
+        return;
+    }
+    TeamScores[Index] = Event.Score;
+    MarkDirty(EUIGameStateField::TeamScores);
 }
 
 void UUIGameState::SetSecondsUntilMatchRestarts(
     const float NewSecondsUntilMatchRestarts)
 {
-    const float OldSecondsUntilMatchRestarts = SecondsUntilMatchRestarts;
-    SecondsUntilMatchRestarts = NewSecondsUntilMatchRestarts;
-    OnSecondsUntilMatchRestartsUpdated.Broadcast(OldSecondsUntilMatchRestarts,
-        NewSecondsUntilMatchRestarts);
+    UpdatedFields |= EUIGameStateField::SecondsUntilMatchRestarts;
+    const float DisplayedSeconds =
+        QuantizeSeconds(NewSecondsUntilMatchRestarts);
+    if (SecondsUntilMatchRestarts == DisplayedSeconds)
+    {
+        return;
+    }
+    SecondsUntilMatchRestarts = DisplayedSeconds;
+    MarkDirty(EUIGameStateField::SecondsUntilMatchRestarts);
 }
 
 void UUIGameState::SetRoundWinningTeams(
     const TArray<ETeamIndex>& NewRoundWinningTeams)
 {
-    const TArray<ETeamIndex>& OldRoundWinningTeams = RoundWinningTeams;
+    if (RoundWinningTeams == NewRoundWinningTeams)
+    {
+        return;
+    }
     RoundWinningTeams = NewRoundWinningTeams;
-    OnRoundWinningTeamsUpdated.Broadcast(OldRoundWinningTeams,
-        NewRoundWinningTeams);
+    MarkDirty(EUIGameStateField::RoundWinningTeams);
 }
 
 void UUIGameState::SetMatchWinningTeams(
     const TArray<ETeamIndex>& NewMatchWinningTeams)
 {
-    const TArray<ETeamIndex>& OldMatchWinningTeams = MatchWinningTeams;
+    if (MatchWinningTeams == NewMatchWinningTeams)
+    {
+        return;
+    }
     MatchWinningTeams = NewMatchWinningTeams;
-    OnMatchWinningTeamsUpdated.Broadcast(OldMatchWinningTeams,
-        NewMatchWinningTeams);
+    MarkDirty(EUIGameStateField::MatchWinningTeams);
+}
+
+namespace
+{
+    FName ToMatchState(const EMatchPhase Phase)
+    {
+        switch (Phase)
+        {
+        case EMatchPhase::EnteringMap:
+            return MatchState::EnteringMap;
+        case EMatchPhase::WaitingToStart:
+            return MatchState::WaitingToStart;
+        case EMatchPhase::InProgress:
+            return MatchState::InProgress;
+        case EMatchPhase::WaitingPostMatch:
+            return MatchState::WaitingPostMatch;
+        case EMatchPhase::LeavingMap:
+            return MatchState::LeavingMap;
+        case EMatchPhase::Aborted:
+            return MatchState::Aborted;
+        default:
+            return NAME_None;
+        }
+    }
+
+    /**
+     * The teams version that snapshot teams are set with. The team state's
+     * versions count up from 1, so its first update replaces them.
+     */
+    constexpr uint32 JoinSnapshotTeamsVersion = MAX_uint32;
 }
 
+void UUIGameState::ApplyJoinSnapshot(const FTDJoinSnapshot& Snapshot,
+    const float LocalTime)
+{
+    // Anything that the game state has already replicated is newer than the
+    // snapshot, so only what hasn't been set yet is taken from it.
+    const EUIGameStateField Fields = UpdatedFields;
+    if (MatchState.IsNone())
+    {
+        SetMatchState(ToMatchState(Snapshot.MatchRoundState.MatchPhase));
+    }
+    if (RoundPhase == ERoundPhase::None)
+    {
+        SetRoundState(Snapshot.MatchRoundState.RoundPhase);
+    }
+    if (!EnumHasAnyFlags(Fields, EUIGameStateField::MatchTimeInSeconds))
+    {
+        SetMatchTimeInSeconds(Snapshot.MatchTimer.GetSeconds(LocalTime));
+    }
+    if (!EnumHasAnyFlags(Fields, EUIGameStateField::SecondsUntilRoundStarts))
+    {
+        SetSecondsUntilRoundStarts(
+            Snapshot.RoundStartTimer.GetSeconds(LocalTime));
+    }
+    if (!EnumHasAnyFlags(Fields,
+        EUIGameStateField::SecondsUntilMatchRestarts))
+    {
+        SetSecondsUntilMatchRestarts(
+            Snapshot.MatchRestartTimer.GetSeconds(LocalTime));
+    }
+    if (!EnumHasAnyFlags(Fields, EUIGameStateField::TeamScores))
+    {
+        SetTeamScores(Snapshot.TeamScores);
+    }
+
+    // Teams from the team state are newer than the snapshot's.
+    const AGameStateBase* GameState = GetOwner<AGameStateBase>();
+    if (GameState == nullptr || TeamsVersion != 0)
+    {
+        return;
+    }
+
+    TArray<FTeam> SnapshotTeams;
+    for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
+    {
+        SnapshotTeams.Emplace(Index);
+    }
+    for (const FTDJoinSnapshotPlayer& Player : Snapshot.Players)
+    {
+        for (APlayerState* PlayerState : GameState->PlayerArray)
+        {
+            ATDPlayerState* TDPlayerState = Cast<ATDPlayerState>(PlayerState);
+            if (TDPlayerState != nullptr &&
+                TDPlayerState->GetPlayerId() == Player.PlayerId &&
+                SnapshotTeams.IsValidIndex(Int(Player.Team)))
+            {
+                SnapshotTeams[Int(Player.Team)].Players.Emplace(TDPlayerState);
+                break;
+            }
+        }
+    }
+    SetTeams(SnapshotTeams, JoinSnapshotTeamsVersion);
+}
+
+#pragma endregion
+
 ETeamIndex UUIGameState::GetWinnerTeam() const
 {
     uint8 Index = 0;
@@ -8,6 +8,10 @@
 #include "Components/ActorComponent.h"
 #include "UIGameState.generated.h"
 
+struct FTDJoinSnapshot;
+struct FTDPhaseChangedEvent;
+struct FTDScoreChangedEvent;
+
 /**
  * @brief Enum representing the result a player's request (usually an RPC).
  */
@@ -34,9 +38,33 @@ struct TD_API FPlayerRequest
     FString Message;
 };
 
+/**
+ * @brief Flags for the UI data whose updates are batched and broadcast at the
+ * end of the frame.
+ */
+enum class EUIGameStateField : uint8
+{
+    None = 0,
+    Teams = 1 << 0,
+    MatchTimeInSeconds = 1 << 1,
+    SecondsUntilRoundStarts = 1 << 2,
+    TeamScores = 1 << 3,
+    SecondsUntilMatchRestarts = 1 << 4,
+    RoundWinningTeams = 1 << 5,
+    MatchWinningTeams = 1 << 6,
+};
+
+ENUM_CLASS_FLAGS(EUIGameStateField);
+
 /**
  * @brief Subset of the Game State plus whatever other information that the UI
  * needs to know about.
+ *
+ * State change events (match state, round state, and player requests) are
+ * broadcast immediately. Everything else is only broadcast when it changes,
+ * at most once per frame at the end of the frame, so that widget updates are
+ * proportional to what's actually visible. Timers are quantized to
+ * TimerDisplayGranularityInSeconds before being compared.
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class TD_API UUIGameState : public UActorComponent
@@ -46,6 +74,8 @@ class TD_API UUIGameState : public UActorComponent
     /**
      * Declare variable and corresponding delegate template.
      * Replace VariableType, VariableName, and OnRoundStateUpdated.
+     * Add VariableName to EUIGameStateField and broadcast it in
+     * BroadcastDirtyFields().
     
 public:
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FDelegateName, VariableType, OldVariableName, VariableType, NewVariableName);
@@ -59,8 +89,31 @@ protected:
     UPROPERTY(BlueprintReadOnly)
     VariableType VariableName;
 
+private:
+    VariableType BroadcastVariableName;
+
     */
 
+#pragma region Initialization
+
+public:
+    UUIGameState();
+
+    /**
+     * @brief Subscribes to the game state's phase and score changes.
+     */
+    virtual void BeginPlay() override;
+
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /**
+     * @brief Broadcasts all fields that changed this frame.
+     */
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+        FActorComponentTickFunction* ThisTickFunction) override;
+
+#pragma endregion
+
 #pragma region Delegate Declarations
 
 public:
@@ -116,6 +169,16 @@ public:
         const TArray<ETeamIndex>&, NewMatchWinningTeams);
 
 private:
+    /**
+     * @brief Sets the round state from the event.
+     */
+    void HandlePhaseChanged(const FTDPhaseChangedEvent& Event);
+
+    /**
+     * @brief Sets the team's score from the event.
+     */
+    void HandleScoreChanged(const FTDScoreChangedEvent& Event);
+
     /**
      * @brief Broadcasts match state changes.
      */
@@ -128,6 +191,46 @@ private:
 
 #pragma endregion
 
+#pragma region Batched Broadcasts
+
+protected:
+    /**
+     * @brief The granularity that timers are displayed at. Timer updates are
+     * only broadcast when the displayed value changes.
+     */
+    UPROPERTY(EditAnywhere, Category = "Game HUD")
+    float TimerDisplayGranularityInSeconds = 1.0f;
+
+private:
+    /**
+     * @brief Fields that have changed since the last broadcast.
+     */
+    EUIGameStateField DirtyFields = EUIGameStateField::None;
+
+    /**
+     * @brief Fields that have been set at least once, which a join snapshot
+     * doesn't overwrite. Teams are tracked by TeamsVersion instead.
+     */
+    EUIGameStateField UpdatedFields = EUIGameStateField::None;
+
+    /**
+     * @brief Marks a field as changed so it's broadcast at the end of the
+     * frame.
+     */
+    void MarkDirty(const EUIGameStateField Field);
+
+    /**
+     * @brief Broadcasts all fields that have changed since the last broadcast.
+     */
+    void BroadcastDirtyFields();
+
+    /**
+     * @brief Rounds the seconds up to the display granularity.
+     */
+    float QuantizeSeconds(const float Seconds) const;
+
+#pragma endregion
+
 #pragma region Delegate Members
 
 public:
@@ -185,8 +288,8 @@ public:
 
 public:
     void SetMatchState(const FName& NewMatchState);
-    void SetRoundState(const FName& NewRoundState);
-    void SetTeams(const TArray<FTeam>& NewTeams);
+    void SetRoundState(const ERoundPhase NewRoundPhase);
+    void SetTeams(const TArray<FTeam>& NewTeams, const uint32 NewTeamsVersion);
     void SetPlayerRequest(const FPlayerRequest& NewPlayerRequest);
     void SetMatchTimeInSeconds(const float NewSecondsUntilMatchEnds);
     void SetSecondsUntilRoundStarts(const float NewSecondsUntilRoundStarts);
@@ -195,6 +298,16 @@ public:
     void SetRoundWinningTeams(const TArray<ETeamIndex>& NewRoundWinningTeams);
     void SetMatchWinningTeams(const TArray<ETeamIndex>& NewMatchWinningTeams);
 
+    /**
+     * @brief Seeds the phases, timers, scores and teams that haven't been set
+     * by the game state yet from a join snapshot. Only players whose states
+     * have replicated are listed in the teams.
+     * @param LocalTime The local time that the snapshot's timers started at.
+     * @see ATDController::Client_ReceiveJoinSnapshot
+     */
+    void ApplyJoinSnapshot(const FTDJoinSnapshot& Snapshot,
+        const float LocalTime);
+
 #pragma endregion
 
 #pragma region Variables
@@ -222,6 +335,9 @@ protected:
     UPROPERTY(BlueprintReadOnly)
     FName RoundState;
 
+    UPROPERTY(BlueprintReadOnly)
+    ERoundPhase RoundPhase = ERoundPhase::None;
+
     UPROPERTY(BlueprintReadOnly, Category = "UI Data")
     TArray<FTeam> Teams;
 
@@ -249,5 +365,29 @@ protected:
     UPROPERTY(BlueprintReadOnly, Category = "Player Requests")
     FPlayerRequest PlayerRequest;
 
+private:
+    /**
+     * @brief The version of the teams array, used to skip copying teams that
+     * haven't changed. @see UTeamState::TeamsVersion
+     */
+    uint32 TeamsVersion = 0;
+
+    /**
+     * The values that were last broadcast, passed as the old values to the
+     * delegates.
+     */
+
+    /**
+     * @brief The teams before the change being broadcast, which SetTeams
+     * moves Teams into instead of copying them after the broadcast.
+     */
+    TArray<FTeam> BroadcastTeams;
+    float BroadcastMatchTimeInSeconds = 0.0f;
+    float BroadcastSecondsUntilRoundStarts = 0.0f;
+    TArray<uint8> BroadcastTeamScores;
+    float BroadcastSecondsUntilMatchRestarts = 0.0f;
+    TArray<ETeamIndex> BroadcastRoundWinningTeams;
+    TArray<ETeamIndex> BroadcastMatchWinningTeams;
+
 #pragma endregion
 };
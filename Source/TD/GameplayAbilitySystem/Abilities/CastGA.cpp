@@ -26,6 +26,7 @@ void UCastGA::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
     if (!CommitCheck(Handle, ActorInfo, ActivationInfo))
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+        return;
     }
 
     bool WasSuccessful = CastOrb(HasAuthority(&ActivationInfo));
@@ -49,7 +50,7 @@ bool UCastGA::CastOrb(bool HasAuthority) const
         return false;
     }
 
-    if (!GameRules->CanCastOrb())
+    if (!GameRules->CanCastOrb(Character))
     {
         return false;
     }
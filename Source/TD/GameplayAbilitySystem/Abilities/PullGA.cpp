@@ -14,6 +14,7 @@ UPullGA::UPullGA()
 {
     AbilityInputID = ETDAbilityInputID::Pull;
     AbilityName = "Pull";
+    QueuedTelekinese = ETelekinese::Pull;
 }
 
 void UPullGA::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -24,37 +25,42 @@ void UPullGA::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
     if (!CommitCheck(Handle, ActorInfo, ActivationInfo))
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+        return;
     }
 
-    bool WasSuccessful = Pull();
-    if (WasSuccessful)
+    const ETelekineseResult Result = Pull(
+        MakeCommitOnResolved(Handle, ActorInfo, ActivationInfo));
+    if (Result == ETelekineseResult::Hit)
     {
         CommitExecute(Handle, ActorInfo, ActivationInfo);
         ActorInfo->AbilitySystemComponent->NotifyAbilityCommit(this);
     }
-    else
+    else if (Result == ETelekineseResult::Missed)
     {
         PlayTelekineseMissCue();
     }
-    EndAbility(Handle, ActorInfo, ActivationInfo, true, !WasSuccessful);
+    // A queued pull is committed when the server resolves it.
+    EndAbility(Handle, ActorInfo, ActivationInfo, true,
+        Result == ETelekineseResult::Missed);
 }
 
-bool UPullGA::Pull() const
+ETelekineseResult UPullGA::Pull(
+    const FTDTelekineseResolved& OnResolved) const
 {
     ATDCharacter* Character = Cast<ATDCharacter>(GetAvatarActorFromActorInfo());
     AGameRules* GameRules = GetGameRules();
     if (Character == nullptr)
     {
         LogInvalidPointer("UCastGA", "PredictPull", "Character");
-        return false;
+        return ETelekineseResult::Missed;
     }
 
-    if (!GameRules->CanPull())
+    if (!GameRules->CanPull(Character))
     {
-        return false;
+        return ETelekineseResult::Missed;
     }
 
-    return Character->Pull();
+    return Character->Pull(OnResolved);
 }
 
 void UPullGA::PlayTelekineseMissCue() const
@@ -35,9 +35,10 @@ protected:
 private:
     /**
      * @brief Calls Pull for the player if allowed.
-     * @return Whether the pull succeeded.
+     * @param OnResolved Called with whether a queued pull hit.
+     * @return Whether the pull hit, missed or was queued.
      */
-    bool Pull() const;
+    ETelekineseResult Pull(const FTDTelekineseResolved& OnResolved) const;
 
     /**
      * @brief Plays the telekinese miss sound effect.
@@ -14,6 +14,7 @@ UPushGA::UPushGA()
 {
     AbilityInputID = ETDAbilityInputID::Push;
     AbilityName = "Push";
+    QueuedTelekinese = ETelekinese::Push;
 }
 
 void UPushGA::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -24,37 +25,42 @@ void UPushGA::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
     if (!CommitCheck(Handle, ActorInfo, ActivationInfo))
     {
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+        return;
     }
 
-    bool WasSuccessful = Push();
-    if (WasSuccessful)
+    const ETelekineseResult Result = Push(
+        MakeCommitOnResolved(Handle, ActorInfo, ActivationInfo));
+    if (Result == ETelekineseResult::Hit)
     {
         CommitExecute(Handle, ActorInfo, ActivationInfo);
         ActorInfo->AbilitySystemComponent->NotifyAbilityCommit(this);
     }
-    else
+    else if (Result == ETelekineseResult::Missed)
     {
         PlayTelekineseMissCue();
     }
-    EndAbility(Handle, ActorInfo, ActivationInfo, true, !WasSuccessful);
+    // A queued push is committed when the server resolves it.
+    EndAbility(Handle, ActorInfo, ActivationInfo, true,
+        Result == ETelekineseResult::Missed);
 }
 
-bool UPushGA::Push() const
+ETelekineseResult UPushGA::Push(
+    const FTDTelekineseResolved& OnResolved) const
 {
     ATDCharacter* Character = Cast<ATDCharacter>(GetAvatarActorFromActorInfo());
     AGameRules* GameRules = GetGameRules();
     if (Character == nullptr || GameRules == nullptr)
     {
         LogInvalidPointer("UCastGA", "PredictPush", "Character or GameRules");
-        return false;
+        return ETelekineseResult::Missed;
     }
 
-    if (!GameRules->CanPush())
+    if (!GameRules->CanPush(Character))
     {
-        return false;
+        return ETelekineseResult::Missed;
     }
 
-    return Character->Push();
+    return Character->Push(OnResolved);
 }
 
 void UPushGA::PlayTelekineseMissCue() const
@@ -35,9 +35,10 @@ protected:
 private:
     /**
      * @brief Calls Push for the player if allowed.
-     * @return Whether the push succeeded.
+     * @param OnResolved Called with whether a queued push hit.
+     * @return Whether the push hit, missed or was queued.
      */
-    bool Push() const;
+    ETelekineseResult Push(const FTDTelekineseResolved& OnResolved) const;
 
     /**
      * @brief Plays the telekinese miss sound effect.
@@ -2,11 +2,22 @@
 
 #include "TDGA.h"
 
-#include "EngineUtils.h"
+#include "AbilitySystemComponent.h"
 #include "GameConfiguration.h"
+#include "TDTelekineseQueue.h"
+#include "TDWorldRegistry.h"
 #include "GameModes/TDGameMode.h"
 #include "GameState/TDGameState.h"
 #include "GameRules/GameRules.h"
+#include "Player/TDCharacter.h"
+
+UTDGA::UTDGA()
+{
+    NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+    // Instances have nothing for other clients, so they aren't replicated as
+    // subobjects of the ASC.
+    ReplicationPolicy = EGameplayAbilityReplicationPolicy::ReplicateNo;
+}
 
 int32 UTDGA::GetAbilityInputID() const
 {
@@ -18,6 +29,39 @@ FString UTDGA::GetAbilityName() const
     return AbilityName;
 }
 
+bool UTDGA::GetIsActivationBatched() const
+{
+    return IsActivationBatched;
+}
+
+bool UTDGA::CanActivateAbility(const FGameplayAbilitySpecHandle Handle,
+    const FGameplayAbilityActorInfo* ActorInfo,
+    const FGameplayTagContainer* SourceTags,
+    const FGameplayTagContainer* TargetTags,
+    FGameplayTagContainer* OptionalRelevantTags) const
+{
+    const ATDCharacter* Character = ActorInfo != nullptr
+                                        ? Cast<ATDCharacter>(
+                                            ActorInfo->AvatarActor.Get())
+                                        : nullptr;
+    if (Character != nullptr && Character->GetIsDeactivated())
+    {
+        return false;
+    }
+
+    const UTDTelekineseQueue* Queue = QueuedTelekinese.IsSet()
+                                          ? UTDTelekineseQueue::Get(Character)
+                                          : nullptr;
+    if (Queue != nullptr &&
+        Queue->HasPendingRequest(Character, QueuedTelekinese.GetValue()))
+    {
+        return false;
+    }
+
+    return Super::CanActivateAbility(Handle, ActorInfo, SourceTags,
+        TargetTags, OptionalRelevantTags);
+}
+
 ATDGameMode* UTDGA::GetGameMode() const
 {
     UWorld* World = GetWorld();
@@ -44,12 +88,51 @@ ATDGameState* UTDGA::GetGameState() const
 
 AGameRules* UTDGA::GetGameRules() const
 {
-    TActorIterator<AGameRules> GameRulesPtr(GetWorld());
-    if (!GameRulesPtr)
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
     {
-        LogInvalidPointer("UTDGA", "GetGameRules", "GameRulesPtr");
+        LogInvalidPointer("UTDGA", "GetGameRules", "Registry");
         return nullptr;
     }
 
-    return *GameRulesPtr;
+    AGameRules* GameRules = Registry->GetGameRules();
+    if (GameRules == nullptr)
+    {
+        LogInvalidPointer("UTDGA", "GetGameRules", "GameRules");
+        return nullptr;
+    }
+
+    return GameRules;
+}
+
+FTDTelekineseResolved UTDGA::MakeCommitOnResolved(
+    const FGameplayAbilitySpecHandle Handle,
+    const FGameplayAbilityActorInfo* ActorInfo,
+    const FGameplayAbilityActivationInfo ActivationInfo) const
+{
+    UAbilitySystemComponent* ASC = ActorInfo != nullptr
+                                       ? ActorInfo->AbilitySystemComponent.Get()
+                                       : nullptr;
+    if (ASC == nullptr)
+    {
+        return FTDTelekineseResolved();
+    }
+
+    return FTDTelekineseResolved::CreateWeakLambda(ASC,
+        [ASC, Handle, ActivationInfo](const bool WasSuccessful)
+        {
+            const FGameplayAbilitySpec* Spec =
+                ASC->FindAbilitySpecFromHandle(Handle);
+            UTDGA* Ability = Spec != nullptr
+                                 ? Cast<UTDGA>(Spec->Ability)
+                                 : nullptr;
+            if (!WasSuccessful || Ability == nullptr)
+            {
+                return;
+            }
+
+            Ability->CommitExecute(Handle, ASC->AbilityActorInfo.Get(),
+                ActivationInfo);
+            ASC->NotifyAbilityCommit(Ability);
+        });
 }
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "TDTypes.h"
+#include "Telekinetic.h"
 #include "Abilities/GameplayAbility.h"
 #include "TDGA.generated.h"
 
@@ -14,6 +15,9 @@ class ATDGameMode;
 
 /**
  * @brief Base class for gameplay abilities, defines an input id and a name.
+ * Abilities are locally predicted, and by default end before ActivateAbility
+ * returns so that their activation can be batched.
+ * @see UTDCharacterASC::AbilityLocalInputPressed
  */
 UCLASS()
 class TD_API UTDGA : public UGameplayAbility
@@ -21,6 +25,8 @@ class TD_API UTDGA : public UGameplayAbility
     GENERATED_BODY()
 
 public:
+    UTDGA();
+
     /**
      * @brief Gets the input ID of this gameplay ability.
      * @return The input ID of this ability, as an int32.
@@ -33,6 +39,26 @@ public:
      */
     FString GetAbilityName() const;
 
+    /**
+     * @brief Gets whether activating this ability batches its activate, commit
+     * and end into one server RPC.
+     */
+    bool GetIsActivationBatched() const;
+
+    /**
+     * @brief Also fails if the avatar is an eliminated character, which stays
+     * possessed until it's reactivated, so that the server rejects activations
+     * that were sent before the client found out. A telekinese ability also
+     * fails while the character's previous one is queued on the server, since
+     * its cooldown isn't applied until the queue resolves it.
+     */
+    virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle,
+        const FGameplayAbilityActorInfo* ActorInfo,
+        const FGameplayTagContainer* SourceTags = nullptr,
+        const FGameplayTagContainer* TargetTags = nullptr,
+        OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const
+    override;
+
 protected:
     /**
      * @brief The input ID enum value for this ability.
@@ -46,6 +72,20 @@ protected:
     UPROPERTY(BlueprintReadOnly, EditAnywhere, Category = "Ability")
     FString AbilityName = "Unnamed Ability";
 
+    /**
+     * @brief Whether to batch the ability's activation RPCs. Only abilities
+     * that always end within ActivateAbility can be batched, since the batch is
+     * sent as soon as ActivateAbility returns.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Ability")
+    bool IsActivationBatched = true;
+
+    /**
+     * @brief The kind of telekinese that this ability queues on the server, if
+     * it's a telekinese ability. @see UTDTelekineseQueue
+     */
+    TOptional<ETelekinese> QueuedTelekinese;
+
     /**
      * @brief Gets the TDGameMode or nullptr if not the server.
      */
@@ -60,4 +100,14 @@ protected:
      * @brief Gets the Game Rules for the current game mode.
      */
     AGameRules* GetGameRules() const;
+
+    /**
+     * @brief Makes a callback that commits the ability if its queued telekinese
+     * hits. The activation that queued it has already ended by then, so the
+     * spec's ability commits on its behalf, under the same prediction key.
+     */
+    FTDTelekineseResolved MakeCommitOnResolved(
+        const FGameplayAbilitySpecHandle Handle,
+        const FGameplayAbilityActorInfo* ActorInfo,
+        const FGameplayAbilityActivationInfo ActivationInfo) const;
 };
@@ -44,6 +44,7 @@ bool ALSGameMode::ReadyToStartMatch_Implementation()
                 Callback.BindLambda([&]()
                 {
                     HasStartMatchDelayPassed = true;
+                    HandleStartMatchDelayPassed();
                 });
                 GetWorldTimerManager().SetTimer(StartMatchDelayTimerHandle,
                     Callback, StartMatchDelay, false);
@@ -54,6 +55,10 @@ bool ALSGameMode::ReadyToStartMatch_Implementation()
     return false;
 }
 
+void ALSGameMode::HandleStartMatchDelayPassed()
+{
+}
+
 void ALSGameMode::StartMatch()
 {
     Super::StartMatch();
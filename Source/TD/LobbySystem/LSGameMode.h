@@ -56,6 +56,13 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Base Game Mode")
     float StartMatchDelay = 3.0f;
 
+    /**
+     * @brief Callback for when the @link StartMatchDelay has passed. Does
+     * nothing by default; subclasses that don't poll ReadyToStartMatch every
+     * tick can use this to check again.
+     */
+    virtual void HandleStartMatchDelayPassed();
+
 private:
     /**
      * @brief Whether the match delay has passed if using @link StartMatchDelay.
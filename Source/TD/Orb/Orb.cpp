@@ -2,13 +2,18 @@
 
 #include "Orb.h"
 
-#include "EngineUtils.h"
 #include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
 #include "OrbMovement.h"
 #include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
 #include "GameModes/TDGameMode.h"
 #include "GameRules/GameRules.h"
 #include "GameState/TDGameState.h"
+#include "GameState/Components/OrbState.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 #include "Player/TDCharacter.h"
 #include "Sound/SoundCue.h"
@@ -19,6 +24,8 @@ AOrb::AOrb()
 {
     PrimaryActorTick.bCanEverTick = true;
     bReplicates = true;
+    // Ahead of level actors, behind the game and player states.
+    NetPriority = 2.0f;
     SetReplicateMovement(true);
 
     CreateCollider();
@@ -72,7 +79,9 @@ void AOrb::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(AOrb, Team);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(AOrb, Team, Params);
 }
 
 void AOrb::OnRep_Team()
@@ -89,8 +98,7 @@ void AOrb::SetInitialTeam()
             GetLocalRole());
         return;
     }
-    Team = Caster->GetTeam();
-    OnTeamSet();
+    SetTeam(Caster->GetTeam());
 }
 
 void AOrb::OnTeamSet()
@@ -115,12 +123,34 @@ void AOrb::BeginPlay()
     Movement->OnProjectileBounce.AddDynamic(this, &AOrb::OnOrbBounce);
 }
 
+void AOrb::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    UTDWorldRegistry::RegisterInWorld(this);
+}
+
+void AOrb::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UTDWorldRegistry::UnregisterFromWorld(this);
+    Super::EndPlay(EndPlayReason);
+}
+
 #pragma endregion
 
 #pragma region Collision
 
 void AOrb::OnOrbImpact(const FHitResult& Hit, const FVector& OrbVelocity)
 {
+    if (GetLocalRole() == ROLE_SimulatedProxy)
+    {
+        ATDGameState* GameState = GetWorld()->GetGameState<ATDGameState>();
+        if (AreCosmeticsClientDerived && GameState != nullptr)
+        {
+            GameState->GetOrbStateComponent()->HandleSimulatedOrbImpact(this,
+                Hit);
+        }
+        return;
+    }
     if (!HasAuthority())
     {
         return;
@@ -152,9 +182,10 @@ void AOrb::OnOrbBounce(const FHitResult& Hit, const FVector& OldVelocity)
     }
 }
 
-void AOrb::PlayBounceCue() const
+void AOrb::PlayBounceCue()
 {
-    if (!HasAuthority())
+    const bool IsSimulatedProxy = GetLocalRole() == ROLE_SimulatedProxy;
+    if (IsSimulatedProxy ? !AreCosmeticsClientDerived : !HasAuthority())
     {
         return;
     }
@@ -172,7 +203,57 @@ void AOrb::PlayBounceCue() const
         return;
     }
 
-    GameState->PlayReplicatedCueAtLocation(BounceCue, GetActorLocation());
+    FVector Location = GetActorLocation();
+    if (IsSimulatedProxy)
+    {
+        if (ConsumeCosmeticCue(BounceCue))
+        {
+            GameState->PlayLocalCue(BounceCue, &Location);
+        }
+    }
+    else if (AreCosmeticsClientDerived)
+    {
+        // Clients play their own, so only a listen server's host needs it.
+        if (GetNetMode() != NM_DedicatedServer)
+        {
+            GameState->PlayLocalCue(BounceCue, &Location);
+        }
+    }
+    else
+    {
+        GameState->PlayReplicatedCueAtLocation(BounceCue, Location, this);
+    }
+}
+
+bool AOrb::GetAreCosmeticsClientDerived() const
+{
+    return AreCosmeticsClientDerived;
+}
+
+bool AOrb::ConsumeCosmeticCue(const USoundBase* Sound)
+{
+    const float Time = GetWorld()->GetTimeSeconds();
+    float& LastTime = CosmeticCueTimes.FindOrAdd(Sound, -MAX_flt);
+    if (Time - LastTime < GetCosmeticCueDedupeSeconds())
+    {
+        return false;
+    }
+    LastTime = Time;
+    return true;
+}
+
+float AOrb::GetCosmeticCueDedupeSeconds() const
+{
+    const APlayerController* PlayerController =
+        GEngine->GetFirstLocalPlayerController(GetWorld());
+    const APlayerState* PlayerState = PlayerController != nullptr
+                                          ? PlayerController->PlayerState
+                                          : nullptr;
+    // ExactPing is the round trip in milliseconds.
+    const float RoundTripSeconds = PlayerState != nullptr
+                                       ? PlayerState->ExactPing * 0.001f
+                                       : 0.0f;
+    return RoundTripSeconds + CosmeticCueDedupeMarginSeconds;
 }
 
 #pragma endregion
@@ -205,8 +286,10 @@ void AOrb::OnPulled(ATDCharacter* Player, const FHitResult& Hit)
 
 bool AOrb::CanBeTelekinesedBy(ATDCharacter* Player) const
 {
-    TActorIterator<AGameRules> It(GetWorld());
-    AGameRules* GameRules = *It;
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    AGameRules* GameRules = Registry != nullptr
+                                ? Registry->GetGameRules()
+                                : nullptr;
     if (GameRules == nullptr)
     {
         LogInvalidPointer("AOrb", "CanBeTelekinesedBy", "GameRules");
@@ -246,6 +329,7 @@ ETeamIndex AOrb::GetTeam() const
 void AOrb::SetTeam(const ETeamIndex TeamIndex)
 {
     Team = TeamIndex;
+    MARK_PROPERTY_DIRTY_FROM_NAME(AOrb, Team, this);
     OnTeamSet();
 }
 
@@ -9,6 +9,7 @@
 #include "GameFramework/Actor.h"
 #include "Orb.generated.h"
 
+class USoundBase;
 class USoundCue;
 class USphereComponent;
 class UOrbMovement;
@@ -47,6 +48,16 @@ protected:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief Registers with the UTDWorldRegistry.
+     */
+    virtual void PostInitializeComponents() override;
+
+    /**
+     * @brief Unregisters from the UTDWorldRegistry.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
 	 * @brief The sphere the bullet uses to detect collision.
 	 */
@@ -80,6 +91,17 @@ private:
 
 #pragma region Collision
 
+public:
+    bool GetAreCosmeticsClientDerived() const;
+
+    /**
+     * @brief Records that a cosmetic cue is being played for this orb, unless
+     * the same cue was already played for it within the dedupe window, e.g.
+     * when the server's cue arrives after the client played its own.
+     * @return Whether the cue should be played.
+     */
+    bool ConsumeCosmeticCue(const USoundBase* Sound);
+
 protected:
     /**
      * @brief The sound effect to play when colliding with a non-orb actor.
@@ -87,10 +109,41 @@ protected:
     UPROPERTY(EditAnywhere, Category = "Collision")
     USoundCue* BounceCue = nullptr;
 
+    /**
+     * @brief Whether clients play the bounce and orb collision cues from their
+     * own simulation of the orb instead of waiting a round trip for the
+     * server. The server then stops sending bounce cues, and the collision
+     * cues that it still sends are deduped.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Collision")
+    bool AreCosmeticsClientDerived = true;
+
+    /**
+     * @brief How much longer than the local player's round trip that the same
+     * cosmetic cue is ignored for after it's played for this orb, to cover
+     * jitter and the server's frame.
+     */
+    UPROPERTY(EditDefaultsOnly, Category = "Collision")
+    float CosmeticCueDedupeMarginSeconds = 0.1f;
+
 private:
+    /**
+     * @brief Gets how long after a cosmetic cue is played for this orb that
+     * the same cue is ignored: the local player's round trip, which is how
+     * late the server's cue arrives, plus the margin.
+     */
+    float GetCosmeticCueDedupeSeconds() const;
+
+    /**
+     * @brief The world time that each cosmetic cue was last played at for this
+     * orb.
+     */
+    TMap<const USoundBase*, float> CosmeticCueTimes;
+
     /**
      * @brief Requests the TDGameMode to eliminate a player if the orb hits a
-     * player of a different team from this orb.
+     * player of a different team from this orb. On clients, plays the orb
+     * collision cue if the cosmetics are client derived.
      */
     void OnOrbImpact(const FHitResult& Hit, const FVector& OrbVelocity);
 
@@ -102,9 +155,10 @@ private:
 
 private:
     /**
-     * @brief Plays the bounce sound effect.
+     * @brief Plays the bounce sound effect, locally if the cosmetics are
+     * client derived.
      */
-    void PlayBounceCue() const;
+    void PlayBounceCue();
 
 #pragma endregion
 
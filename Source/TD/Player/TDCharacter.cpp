@@ -7,11 +7,15 @@
 #include "TDTypes.h"
 #include "GameConfiguration.h"
 #include "TDPlayerState.h"
+#include "TDRewindHistory.h"
+#include "TDTelekineseQueue.h"
+#include "TDWorldRegistry.h"
 #include "Telekinetic.h"
 #include "Components/CapsuleComponent.h"
 #include "TDGameInstance.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameState/TDGameState.h"
+#include "Net/UnrealNetwork.h"
 #include "Orb/Orb.h"
 #include "Sound/SoundCue.h"
 
@@ -20,10 +24,6 @@
 ATDCharacter::ATDCharacter(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
-    ASC = CreateDefaultSubobject<UTDCharacterASC>(TEXT("ASC"));
-    ASC->SetIsReplicated(true);
-    ASC->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
-
     StaticMesh = CreateDefaultSubobject<UStaticMeshComponent>(
         TEXT("StaticMesh"));
     StaticMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -32,16 +32,25 @@ ATDCharacter::ATDCharacter(const FObjectInitializer& ObjectInitializer)
     GetCapsuleComponent()->SetCollisionProfileName(TEXT("Player"));
 }
 
-void ATDCharacter::InitASC(AController* NewController)
+void ATDCharacter::InitAbilityActorInfo()
 {
+    ATDPlayerState* TDPlayerState = GetPlayerState<ATDPlayerState>();
+    UTDCharacterASC* ASC = GetASC();
     if (ASC == nullptr)
     {
-        LogInvalidPointer("ATDCharacter", "PossessedBy", "ASC");
         return;
     }
 
-    ASC->InitAbilityActorInfo(this, this);
-    SetOwner(NewController);
+    ASC->InitAbilityActorInfo(TDPlayerState, this);
+    BindASCInput();
+}
+
+UTDCharacterASC* ATDCharacter::GetASC() const
+{
+    const ATDPlayerState* TDPlayerState = GetPlayerState<ATDPlayerState>();
+    return TDPlayerState != nullptr
+               ? TDPlayerState->GetTDAbilitySystemComponent()
+               : nullptr;
 }
 
 void ATDCharacter::SetMeshTeamMaterial()
@@ -61,26 +70,30 @@ void ATDCharacter::SetMeshTeamMaterial()
 void ATDCharacter::PossessedBy(AController* NewController)
 {
     Super::PossessedBy(NewController);
-    InitASC(NewController);
+    SetOwner(NewController);
+    UTDCharacterASC* ASC = GetASC();
+    if (ASC == nullptr)
+    {
+        LogInvalidPointer("ATDCharacter", "PossessedBy", "ASC");
+        return;
+    }
+
+    // Only grants the first time; the specs stay on the player state.
+    ASC->GrantDefaultAbilities();
+    InitAbilityActorInfo();
     SetMeshTeamMaterial();
 }
 
 void ATDCharacter::OnRep_PlayerState()
 {
     Super::OnRep_PlayerState();
+    InitAbilityActorInfo();
     SetMeshTeamMaterial();
 }
 
 void ATDCharacter::BeginPlay()
 {
     Super::BeginPlay();
-    if (ASC == nullptr)
-    {
-        LogInvalidPointer("ATDCharacter", "BeginPlay", "ASC");
-        return;
-    }
-    ASC->GrantDefaultAbilities();
-
     UTDGameInstance* GameInstance = Cast<UTDGameInstance>(GetGameInstance());
     if (GameInstance == nullptr)
     {
@@ -92,6 +105,25 @@ void ATDCharacter::BeginPlay()
         &ATDCharacter::OnGameplaySettingsSaved);
 }
 
+void ATDCharacter::PostInitializeComponents()
+{
+    Super::PostInitializeComponents();
+    UTDWorldRegistry::RegisterInWorld(this);
+}
+
+void ATDCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UTDWorldRegistry::UnregisterFromWorld(this);
+    Super::EndPlay(EndPlayReason);
+}
+
+void ATDCharacter::GetLifetimeReplicatedProps(
+    TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    DOREPLIFETIME(ATDCharacter, IsDeactivated);
+}
+
 void ATDCharacter::OnGameplaySettingsSaved(
     const FPlayerGameplaySettings& NewSettings)
 {
@@ -100,7 +132,7 @@ void ATDCharacter::OnGameplaySettingsSaved(
 
 void ATDCharacter::Eliminate()
 {
-    if (IsActorBeingDestroyed())
+    if (IsDeactivated || IsActorBeingDestroyed())
     {
         return;
     }
@@ -109,7 +141,58 @@ void ATDCharacter::Eliminate()
     TDPlayerState->SetIsEliminated(true);
     PlayEliminatedCue();
 
-    Destroy();
+    IsDeactivated = true;
+    ApplyIsDeactivated();
+    UTDCharacterASC* ASC = GetASC();
+    if (ASC != nullptr)
+    {
+        ASC->CancelAllAbilities();
+    }
+    // IsDeactivated is still sent before the channel goes dormant.
+    SetNetDormancy(DORM_DormantAll);
+}
+
+void ATDCharacter::Reactivate(const FVector& Location, const FRotator& Rotation)
+{
+    if (IsDeactivated)
+    {
+        SetNetDormancy(DORM_Awake);
+        IsDeactivated = false;
+        ApplyIsDeactivated();
+    }
+
+    TeleportTo(Location, Rotation, false, true);
+    GetCharacterMovement()->StopMovementImmediately();
+}
+
+bool ATDCharacter::GetIsDeactivated() const
+{
+    return IsDeactivated;
+}
+
+void ATDCharacter::OnRep_IsDeactivated()
+{
+    ApplyIsDeactivated();
+}
+
+void ATDCharacter::ApplyIsDeactivated()
+{
+    SetActorHiddenInGame(IsDeactivated);
+    SetActorEnableCollision(!IsDeactivated);
+
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    if (IsDeactivated)
+    {
+        Movement->StopMovementImmediately();
+        Movement->DisableMovement();
+        DisableInput(nullptr);
+    }
+    else
+    {
+        Movement->SetMovementMode(MOVE_Walking);
+        EnableInput(nullptr);
+    }
+    Movement->SetComponentTickEnabled(!IsDeactivated);
 }
 
 void ATDCharacter::PlayEliminatedCue() const
@@ -137,45 +220,98 @@ void ATDCharacter::PlayEliminatedCue() const
 
 UAbilitySystemComponent* ATDCharacter::GetAbilitySystemComponent() const
 {
-    return ASC;
+    return GetASC();
 }
 
-bool ATDCharacter::Push()
+ETelekineseResult ATDCharacter::Push(
+    const FTDTelekineseResolved& OnResolved)
 {
+    if (QueueTelekinese(ETelekinese::Push, OnResolved))
+    {
+        return ETelekineseResult::Queued;
+    }
+
     FHitResult Hit;
     ITelekinetic* ATelekinetic = GetTelekineticTrace(Hit);
-    if (ATelekinetic != nullptr)
+    if (ATelekinetic == nullptr)
     {
-        ATelekinetic->OnPushed(this, Hit);
+        return ETelekineseResult::Missed;
     }
-    return ATelekinetic != nullptr;
+    ATelekinetic->OnPushed(this, Hit);
+    return ETelekineseResult::Hit;
 }
 
-bool ATDCharacter::Pull()
+ETelekineseResult ATDCharacter::Pull(
+    const FTDTelekineseResolved& OnResolved)
 {
+    if (QueueTelekinese(ETelekinese::Pull, OnResolved))
+    {
+        return ETelekineseResult::Queued;
+    }
+
     FHitResult Hit;
     ITelekinetic* ATelekinetic = GetTelekineticTrace(Hit);
-    if (ATelekinetic != nullptr)
+    if (ATelekinetic == nullptr)
+    {
+        return ETelekineseResult::Missed;
+    }
+    ATelekinetic->OnPulled(this, Hit);
+    return ETelekineseResult::Hit;
+}
+
+bool ATDCharacter::QueueTelekinese(const ETelekinese Telekinese,
+    const FTDTelekineseResolved& OnResolved)
+{
+    if (!HasAuthority() || IsLocallyControlled())
     {
-        ATelekinetic->OnPulled(this, Hit);
+        return false;
     }
-    return ATelekinetic != nullptr;
+
+    UTDTelekineseQueue* Queue = UTDTelekineseQueue::Get(this);
+    const UTDRewindHistory* RewindHistory = UTDRewindHistory::Get(this);
+    FVector Start;
+    FVector End;
+    if (Queue == nullptr || RewindHistory == nullptr ||
+        !GetTelekineticTraceSegment(Start, End))
+    {
+        LogInvalidPointer("ATDCharacter", "QueueTelekinese",
+            "Queue, RewindHistory or Controller");
+        return false;
+    }
+
+    // Remote players aimed at orbs and characters where they were a moment
+    // ago, so the server traces against where they were then.
+    Queue->Enqueue(this, Telekinese, Start, End,
+        RewindHistory->GetRewindSeconds(GetPlayerState()), OnResolved);
+    return true;
+}
+
+bool ATDCharacter::GetTelekineticTraceSegment(FVector& Start,
+    FVector& End) const
+{
+    if (GetController() == nullptr)
+    {
+        return false;
+    }
+
+    FRotator Rotation;
+    GetController()->GetPlayerViewPoint(Start, Rotation);
+    End = Start + Rotation.Vector() * TelekineticTraceLength;
+    return true;
 }
 
 ITelekinetic* ATDCharacter::GetTelekineticTrace(FHitResult& Hit) const
 {
     UWorld* World = GetWorld();
-    if (World == nullptr || GetController() == nullptr)
+    FVector Start;
+    FVector End;
+    if (World == nullptr || !GetTelekineticTraceSegment(Start, End))
     {
         LogInvalidPointer("ATDCharacter", "TraceTelekinetic",
             "World or Controller");
         return nullptr;
     }
 
-    FVector Start;
-    FRotator Rotation;
-    GetController()->GetPlayerViewPoint(Start, Rotation);
-    FVector End = Start + Rotation.Vector() * TelekineticTraceLength;
     FCollisionQueryParams QueryParams;
     QueryParams.AddIgnoredActor(this);
 
@@ -310,17 +446,23 @@ void ATDCharacter::SetupPlayerInputComponent(
     PlayerInputComponent->BindAxis("FastFall", this,
         &ABFPlayerCharacter::FastFall);
 
-    if (ASC == nullptr)
+    BindASCInput();
+}
+
+void ATDCharacter::BindASCInput()
+{
+    UTDCharacterASC* ASC = GetASC();
+    if (IsASCInputBound || ASC == nullptr || InputComponent == nullptr)
     {
-        LogInvalidPointer("ATDCharacter", "SetupPlayerInputComponent", "ASC");
         return;
     }
 
-    ASC->BindAbilityActivationToInputComponent(PlayerInputComponent,
+    ASC->BindAbilityActivationToInputComponent(InputComponent,
         FGameplayAbilityInputBinds(FString("Confirm"),
             FString("Cancel"), FString("ETDAbilityInputID"),
             static_cast<int32>(ETDAbilityInputID::Confirm),
             static_cast<int32>(ETDAbilityInputID::Cancel)));
+    IsASCInputBound = true;
 }
 
 void ATDCharacter::TurnRight(float Value)
@@ -39,29 +39,42 @@ public:
     ATDCharacter(const FObjectInitializer& ObjectInitializer);
 
     /**
-     * @brief Sets up the ASC for clients.
+     * @brief Grants the player their default abilities, if they haven't been
+     * already, and sets this character as the ASC's avatar on the server.
      */
     virtual void PossessedBy(AController* NewController) override;
 
     /**
-     * @brief Sets the character's team mesh material on the client.
+     * @brief Sets this character as the ASC's avatar and sets the character's
+     * team mesh material on clients.
      */
     virtual void OnRep_PlayerState() override;
 
     /**
-     * @brief Grants the player their default abilities and loads the player's
-     * gameplay settings.
+     * @brief Loads the player's gameplay settings.
      */
     virtual void BeginPlay() override;
 
-private:
     /**
-     * @brief The player character's ability system component.
+     * @brief Registers with the UTDWorldRegistry.
      */
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly,
-        meta = (AllowPrivateAccess = "true"))
-    UTDCharacterASC* ASC = nullptr;
+    virtual void PostInitializeComponents() override;
+
+    /**
+     * @brief Unregisters from the UTDWorldRegistry.
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    virtual void GetLifetimeReplicatedProps(
+        TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+    /**
+     * @brief Points the player state's ASC at this character as its avatar
+     * and binds its input if that hasn't been done yet.
+     */
+    void InitAbilityActorInfo();
+
+private:
     /**
      * @brief The character's static mesh, since there are no animations.
      */
@@ -69,9 +82,22 @@ private:
     UStaticMeshComponent* StaticMesh = nullptr;
 
     /**
-     * @brief Grants ASC abilities on the server.
+     * @brief Whether the ASC's ability input has been bound to this
+     * character's input component. The player state may replicate before or
+     * after the input component is set up, so both try to bind.
      */
-    void InitASC(AController* NewController);
+    bool IsASCInputBound = false;
+
+    /**
+     * @brief Gets the player state's ASC, or nullptr if the player state
+     * hasn't replicated yet.
+     */
+    UTDCharacterASC* GetASC() const;
+
+    /**
+     * @brief Binds the ASC's ability activation to the input component.
+     */
+    void BindASCInput();
 
     /**
      * @brief Sets the character's team mesh material.
@@ -96,10 +122,23 @@ private:
 
 public:
     /**
-     * @brief Destroys this character and sets the TDPlayerState to eliminated.
+     * @brief Deactivates this character and sets the TDPlayerState to
+     * eliminated. The character isn't destroyed so that it can be reactivated
+     * next round instead of spawning a new one.
      */
     void Eliminate();
 
+    /**
+     * @brief Moves the character to the spawn and reactivates it if it was
+     * eliminated.
+     */
+    void Reactivate(const FVector& Location, const FRotator& Rotation);
+
+    /**
+     * @brief Whether the character was eliminated and hasn't been reactivated.
+     */
+    bool GetIsDeactivated() const;
+
 protected:
     /**
      * @brief The sound effect to play when a player is eliminated.
@@ -108,6 +147,22 @@ protected:
     USoundCue* EliminatedCue = nullptr;
 
 private:
+    /**
+     * @brief Whether the character is hidden, can't collide, move or receive
+     * input, and is net dormant.
+     */
+    UPROPERTY(VisibleInstanceOnly, ReplicatedUsing=OnRep_IsDeactivated)
+    bool IsDeactivated = false;
+
+    UFUNCTION()
+    void OnRep_IsDeactivated();
+
+    /**
+     * @brief Hides the character and disables its collision, movement and
+     * input if it's deactivated, otherwise undoes all of that.
+     */
+    void ApplyIsDeactivated();
+
     /**
      * @brief Plays the eliminated sound effect.
      */
@@ -126,17 +181,21 @@ public:
 
     /**
      * @brief Tries to find a Telekinetic actor in the direction of the player's
-     * crosshair, and if successful, pushes it.
-     * @return Whether the character successfully pushed a telekinetic actor.
+     * crosshair, and if successful, pushes it. A remote player's push is
+     * queued on the server. @see UTDTelekineseQueue
+     * @param OnResolved Called with whether a queued push hit.
+     * @return Whether the push hit, missed or was queued.
      */
-    bool Push();
+    ETelekineseResult Push(const FTDTelekineseResolved& OnResolved);
 
     /**
      * @brief Tries to find a Telekinetic actor in the direction of the player's
-     * crosshair, and if successful, pulls it.
-     * @return Whether the character successfully pulled a telekinetic actor.
+     * crosshair, and if successful, pulls it. A remote player's pull is
+     * queued on the server. @see UTDTelekineseQueue
+     * @param OnResolved Called with whether a queued pull hit.
+     * @return Whether the pull hit, missed or was queued.
      */
-    bool Pull();
+    ETelekineseResult Pull(const FTDTelekineseResolved& OnResolved);
 
     /**
      * @brief Spawns an orb moving in the direction of the player's crosshair.
@@ -166,6 +225,20 @@ private:
     UPROPERTY(EditAnywhere)
     float OrbSpawnOffset = 100.0f;
 
+    /**
+     * @brief Queues the telekinese to be traced with lag compensation if this
+     * is the server and the character is controlled by a remote player.
+     * @return Whether it was queued.
+     */
+    bool QueueTelekinese(const ETelekinese Telekinese,
+        const FTDTelekineseResolved& OnResolved);
+
+    /**
+     * @brief Gets the segment from the player's view point in the direction of
+     * their crosshair. Returns false if the character isn't possessed.
+     */
+    bool GetTelekineticTraceSegment(FVector& Start, FVector& End) const;
+
     /**
      * @brief Line traces for Telekinetic and gets the results.
      * @param Hit Out parameter for the hit result of the line trace.
@@ -4,6 +4,7 @@
 
 #include "GameConfiguration.h"
 #include "GameplayAbilitySystem/Abilities/TDGA.h"
+#include "Net/UnrealNetwork.h"
 
 void UTDCharacterASC::GrantDefaultAbilities()
 {
@@ -23,3 +24,51 @@ void UTDCharacterASC::GrantDefaultAbilities()
     }
     HaveGrantedDefaultAbilities = true;
 }
+
+void UTDCharacterASC::GetLifetimeReplicatedProps(
+    TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    RESET_REPLIFETIME_CONDITION(UTDCharacterASC, ReplicatedPredictionKeyMap,
+        COND_ReplayOrOwner);
+}
+
+#pragma region RPC Batching
+
+bool UTDCharacterASC::ShouldDoServerAbilityRPCBatch() const
+{
+    return true;
+}
+
+void UTDCharacterASC::AbilityLocalInputPressed(int32 InputID)
+{
+    const FGameplayAbilitySpec* Spec = FindBatchedAbilitySpec(InputID);
+    if (Spec == nullptr || IsOwnerActorAuthoritative())
+    {
+        Super::AbilityLocalInputPressed(InputID);
+        return;
+    }
+
+    // The batch is sent when the batcher goes out of scope, after the ability
+    // has activated and ended.
+    FScopedServerAbilityRPCBatcher Batcher(this, Spec->Handle);
+    Super::AbilityLocalInputPressed(InputID);
+}
+
+const FGameplayAbilitySpec* UTDCharacterASC::FindBatchedAbilitySpec(
+    const int32 InputID) const
+{
+    for (const FGameplayAbilitySpec& Spec : ActivatableAbilities.Items)
+    {
+        const UTDGA* Ability = Cast<UTDGA>(Spec.Ability);
+        if (Spec.InputID == InputID && Ability != nullptr)
+        {
+            return !Spec.IsActive() && Ability->GetIsActivationBatched()
+                       ? &Spec
+                       : nullptr;
+        }
+    }
+    return nullptr;
+}
+
+#pragma endregion
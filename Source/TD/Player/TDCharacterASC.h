@@ -9,7 +9,8 @@
 class UTDGA;
 
 /**
- * @brief The player character's ability system component.
+ * @brief The player's ability system component. It lives on the player state
+ * and its avatar is the player's current character.
  */
 UCLASS()
 class TD_API UTDCharacterASC : public UAbilitySystemComponent
@@ -23,6 +24,42 @@ public:
      */
     void GrantDefaultAbilities();
 
+    /**
+     * @brief Only replicates the prediction keys to the owner, since simulated
+     * proxies never predict. They're acknowledged on every activation, so they
+     * were otherwise sent to every connection whenever a player cast, pushed or
+     * pulled.
+     */
+    virtual void GetLifetimeReplicatedProps(
+        TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+#pragma region RPC Batching
+
+public:
+    /**
+     * @brief Allows abilities' server RPCs to be batched.
+     */
+    virtual bool ShouldDoServerAbilityRPCBatch() const override;
+
+    /**
+     * @brief Activates the input's ability inside a batch when it's
+     * predicted by a client, so that its try activate and end, which would be
+     * two RPCs, are sent as one. Costs and cooldowns are committed under the
+     * same prediction key, so they don't add to it.
+     * @see UTDGA::GetIsActivationBatched
+     */
+    virtual void AbilityLocalInputPressed(int32 InputID) override;
+
+private:
+    /**
+     * @brief Gets the spec of the input's ability if it's inactive and can be
+     * batched, or nullptr.
+     */
+    const FGameplayAbilitySpec* FindBatchedAbilitySpec(
+        const int32 InputID) const;
+
+#pragma endregion
+
 protected:
     /**
      * @brief Abilities that the player should start with.
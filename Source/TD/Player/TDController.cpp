@@ -9,6 +9,9 @@
 #include "TDPlayerState.h"
 #include "Blueprint/UserWidget.h"
 #include "GameModes/TDGameMode.h"
+#include "GameState/RoundState.h"
+#include "GameState/TDGameState.h"
+#include "GameState/UIGameState.h"
 #include "UI/TDWidget.h"
 
 #pragma region Initialization
@@ -25,7 +28,7 @@ void ATDController::AcknowledgePossession(APawn* P)
     ATDCharacter* Char = Cast<ATDCharacter>(P);
     if (Char != nullptr)
     {
-        Char->GetAbilitySystemComponent()->InitAbilityActorInfo(Char, Char);
+        Char->InitAbilityActorInfo();
     }
 }
 
@@ -38,6 +41,11 @@ void ATDController::SetupInputComponent()
 
 void ATDController::BeginPlay()
 {
+    if (IsLocalPlayerController() && !HasAuthority())
+    {
+        JoinStartSeconds = FPlatformTime::Seconds();
+    }
+
     if (IsLocalPlayerController())
     {
         if (EscapeMenuClass == nullptr)
@@ -129,3 +137,83 @@ void ATDController::Server_JoinTeam_Implementation(const ETeamIndex Team)
 }
 
 #pragma endregion
+
+#pragma region Join In Progress
+
+void ATDController::Client_ReceiveJoinSnapshot_Implementation(
+    const FTDJoinSnapshot& Snapshot)
+{
+    JoinSnapshot = Snapshot;
+    JoinSnapshot.StartTimers(GetWorld()->GetTimeSeconds());
+    IsJoinSnapshotPending = true;
+    ApplyJoinSnapshot();
+    OnJoinSnapshotReceived.Broadcast(JoinSnapshot);
+}
+
+void ATDController::ApplyJoinSnapshot()
+{
+    const ATDGameState* TDGameState = GetWorld()->GetGameState<ATDGameState>();
+    if (TDGameState == nullptr)
+    {
+        return;
+    }
+
+    IsJoinSnapshotPending = false;
+    TDGameState->GetUIGameState()->ApplyJoinSnapshot(JoinSnapshot,
+        GetWorld()->GetTimeSeconds());
+    WasJoinSnapshotApplied = true;
+}
+
+void ATDController::PlayerTick(float DeltaTime)
+{
+    Super::PlayerTick(DeltaTime);
+    if (IsJoinSnapshotPending)
+    {
+        ApplyJoinSnapshot();
+    }
+
+    if (JoinStartSeconds == 0.0 || !IsPlayable())
+    {
+        return;
+    }
+
+    const float Seconds = FPlatformTime::Seconds() - JoinStartSeconds;
+    JoinStartSeconds = 0.0;
+    UE_LOG(LogTDGM, Log, TEXT("Playable %.1f ms after joining"),
+        Seconds * 1000.0f);
+    Server_ReportTimeToPlayable(Seconds);
+}
+
+bool ATDController::IsPlayable() const
+{
+    const ATDGameState* TDGameState = GetWorld()->GetGameState<ATDGameState>();
+    return TDGameState != nullptr && PlayerState != nullptr &&
+           (WasJoinSnapshotApplied ||
+               TDGameState->GetRoundStateComponent()->GetMatchRoundState().
+                            MatchPhase != EMatchPhase::None);
+}
+
+void ATDController::Server_ReportTimeToPlayable_Implementation(
+    const float Seconds)
+{
+    UE_LOG(LogTDGM, Log, TEXT("%s was playable %.1f ms after joining"),
+        PlayerState != nullptr ? *PlayerState->GetPlayerName() : TEXT(""),
+        Seconds * 1000.0f);
+}
+
+#pragma endregion
+
+#pragma region Cues
+
+void ATDController::Client_PlayCues_Implementation(const TArray<FTDCue>& Cues)
+{
+    const ATDGameState* TDGameState = GetWorld()->GetGameState<ATDGameState>();
+    if (TDGameState == nullptr)
+    {
+        LogInvalidPointer("ATDController", "Client_PlayCues", "TDGameState");
+        return;
+    }
+    TDGameState->GetCueStateComponent()->PlayCues(Cues);
+}
+
+#pragma endregion
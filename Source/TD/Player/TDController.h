@@ -3,6 +3,8 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "TDJoinSnapshot.h"
+#include "GameState/Components/CueState.h"
 #include "GameFramework/PlayerController.h"
 #include "TDController.generated.h"
 
@@ -24,7 +26,8 @@ public:
     ATDController();
 
     /**
-     * @brief Initializes the player character's ASC on the server.
+     * @brief Sets the possessed character as the ASC's avatar on the owning
+     * client.
      */
     virtual void AcknowledgePossession(APawn* P) override;
 
@@ -80,5 +83,95 @@ protected:
     void Server_JoinTeam(const ETeamIndex Team);
     void Server_JoinTeam_Implementation(const ETeamIndex Team);
 
+#pragma endregion
+
+#pragma region Join In Progress
+
+public:
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnJoinSnapshotReceived,
+        const FTDJoinSnapshot&, Snapshot);
+
+    /**
+     * @brief Broadcast when the join snapshot is received so that the UI can
+     * show the match before the game state has replicated.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Join In Progress")
+    FOnJoinSnapshotReceived OnJoinSnapshotReceived;
+
+    /**
+     * @brief Sent by the game mode to a player that joins a match in progress.
+     * @see FTDJoinSnapshot
+     */
+    UFUNCTION(Reliable, Client, Category = "Join In Progress")
+    void Client_ReceiveJoinSnapshot(const FTDJoinSnapshot& Snapshot);
+    void Client_ReceiveJoinSnapshot_Implementation(
+        const FTDJoinSnapshot& Snapshot);
+
+protected:
+    /**
+     * @brief The last join snapshot received. Its timers are started from the
+     * local world time that it was received at.
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Join In Progress")
+    FTDJoinSnapshot JoinSnapshot;
+
+    /**
+     * @brief Applies the join snapshot once the game state exists, and checks
+     * whether the player has become playable.
+     */
+    virtual void PlayerTick(float DeltaTime) override;
+
+private:
+    /**
+     * @brief Whether the join snapshot is waiting for the game state to
+     * replicate so that it can be applied to the UI.
+     */
+    bool IsJoinSnapshotPending = false;
+
+    /**
+     * @brief Whether the join snapshot has been applied to the UI.
+     */
+    bool WasJoinSnapshotApplied = false;
+
+    /**
+     * @brief Seeds the UI game state with whatever the game state hasn't
+     * replicated yet from the join snapshot, once the game state exists.
+     */
+    void ApplyJoinSnapshot();
+
+    /**
+     * @brief The platform time that the local controller began play at, or 0
+     * once the time to playable has been measured.
+     */
+    double JoinStartSeconds = 0.0;
+
+    /**
+     * @brief Check for whether the game state and this player's state have
+     * replicated, and either the join snapshot has been applied or the game
+     * state's match and round phases have replicated.
+     */
+    bool IsPlayable() const;
+
+    /**
+     * @brief Logs how long it took the client to become playable on the
+     * server.
+     */
+    UFUNCTION(Reliable, Server)
+    void Server_ReportTimeToPlayable(const float Seconds);
+    void Server_ReportTimeToPlayable_Implementation(const float Seconds);
+
+#pragma endregion
+
+#pragma region Cues
+
+public:
+    /**
+     * @brief Plays the cues that the player could hear this frame.
+     * @see UCueState
+     */
+    UFUNCTION(Unreliable, Client)
+    void Client_PlayCues(const TArray<FTDCue>& Cues);
+    void Client_PlayCues_Implementation(const TArray<FTDCue>& Cues);
+
 #pragma endregion
 };
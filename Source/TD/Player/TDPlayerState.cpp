@@ -2,13 +2,32 @@
 
 #include "TDPlayerState.h"
 
+#include "GameConfiguration.h"
+#include "TDCharacterASC.h"
+#include "GameState/TDGameState.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Net/UnrealNetwork.h"
 
+ATDPlayerState::ATDPlayerState()
+{
+    ASC = CreateDefaultSubobject<UTDCharacterASC>(TEXT("ASC"));
+    ASC->SetIsReplicated(true);
+    // The owner gets full gameplay effects, while simulated proxies only get
+    // the tags and cues.
+    ASC->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
+
+    NetUpdateFrequency = 100.0f;
+    // Replicated ahead of orbs and level actors to joining players.
+    NetPriority = 4.0f;
+}
+
 void ATDPlayerState::GetLifetimeReplicatedProps(
     TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(ATDPlayerState, Team);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(ATDPlayerState, Team, Params);
 }
 
 ETeamIndex ATDPlayerState::GetTeam() const
@@ -19,6 +38,7 @@ ETeamIndex ATDPlayerState::GetTeam() const
 void ATDPlayerState::SetTeam(const ETeamIndex TeamIndex)
 {
     Team = TeamIndex;
+    MARK_PROPERTY_DIRTY_FROM_NAME(ATDPlayerState, Team, this);
 }
 
 bool ATDPlayerState::GetIsEliminated() const
@@ -28,10 +48,40 @@ bool ATDPlayerState::GetIsEliminated() const
 
 void ATDPlayerState::SetIsEliminated(const bool NewIsEliminated)
 {
+    if (IsEliminated == NewIsEliminated)
+    {
+        return;
+    }
     IsEliminated = NewIsEliminated;
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    UWorld* const World = GetWorld();
+    ATDGameState* const TDGameState = World != nullptr
+                                          ? World->GetGameState<ATDGameState>()
+                                          : nullptr;
+    if (TDGameState == nullptr)
+    {
+        LogInvalidPointer("ATDPlayerState", "SetIsEliminated", "TDGameState");
+        return;
+    }
+    TDGameState->GetEventBus().Broadcast(
+        FTDPlayerEliminatedEvent{this, IsEliminated});
 }
 
 void ATDPlayerState::ResetRoundState()
 {
     SetIsEliminated(false);
 }
+
+UAbilitySystemComponent* ATDPlayerState::GetAbilitySystemComponent() const
+{
+    return ASC;
+}
+
+UTDCharacterASC* ATDPlayerState::GetTDAbilitySystemComponent() const
+{
+    return ASC;
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "AbilitySystemInterface.h"
 #include "TDTypes.h"
 #include "TeamAssignable.h"
 #include "GameFramework/PlayerState.h"
@@ -12,16 +13,28 @@
 class USoundCue;
 class ATDController;
 class ATDCharacter;
+class UTDCharacterASC;
 
 /**
- * @brief Information about the player, replicated to everyone.
+ * @brief Information about the player, replicated to everyone. Also hosts the
+ * player's ability system component so that it and its granted abilities
+ * persist across character respawns.
  */
 UCLASS()
-class TD_API ATDPlayerState : public APlayerState, public ITeamAssignable
+class TD_API ATDPlayerState : public APlayerState, public ITeamAssignable,
+                              public IAbilitySystemInterface
 {
     GENERATED_BODY()
 
 public:
+    /**
+     * @brief Creates the ASC and raises the net update frequency so that
+     * ability state replicates as responsively as it did on the character.
+     * Also raises the net priority so that rosters replicate early. Never made
+     * dormant, since the ASC's server RPCs need an open actor channel.
+     */
+    ATDPlayerState();
+
     virtual void GetLifetimeReplicatedProps(
         TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -35,7 +48,8 @@ public:
     bool GetIsEliminated() const;
 
     /**
-     * @brief Sets whether this player is eliminated.
+     * @brief Sets whether this player is eliminated and publishes it on the
+     * server. @see FTDPlayerEliminatedEvent
      */
     void SetIsEliminated(const bool NewIsEliminated);
 
@@ -45,9 +59,26 @@ public:
      */
     void ResetRoundState();
 
+    /* @see IAbilitySystemInterface */
+    virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+
+    /**
+     * @brief Gets the player's ability system component.
+     */
+    UTDCharacterASC* GetTDAbilitySystemComponent() const;
+
 private:
     /**
-     * @brief The team that the player belongs to.
+     * @brief The player's ability system component. The character is its
+     * avatar.
+     */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly,
+        meta = (AllowPrivateAccess = "true"))
+    UTDCharacterASC* ASC = nullptr;
+
+    /**
+     * @brief The team that the player belongs to. Push based; only set it
+     * through SetTeam.
      */
     UPROPERTY(Replicated)
     ETeamIndex Team = ETeamIndex::None;
@@ -0,0 +1,59 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDCueRegistry.h"
+
+#include "GameConfiguration.h"
+#include "Sound/SoundBase.h"
+
+UTDCueRegistry* UTDCueRegistry::Get()
+{
+    return GetMutableDefault<UTDCueRegistry>();
+}
+
+uint8 UTDCueRegistry::GetCueId(const USoundBase* Sound)
+{
+    LoadCues();
+    const int32 Index = LoadedCues.IndexOfByKey(Sound);
+    return Sound != nullptr && Index != INDEX_NONE
+               ? static_cast<uint8>(Index)
+               : InvalidCueId;
+}
+
+USoundBase* UTDCueRegistry::GetCue(const uint8 CueId)
+{
+    LoadCues();
+    return LoadedCues.IsValidIndex(CueId) ? LoadedCues[CueId] : nullptr;
+}
+
+float UTDCueRegistry::GetAudibleDistanceSquared(const uint8 CueId)
+{
+    LoadCues();
+    return AudibleDistancesSquared.IsValidIndex(CueId)
+               ? AudibleDistancesSquared[CueId]
+               : 0.0f;
+}
+
+void UTDCueRegistry::LoadCues()
+{
+    if (IsLoaded)
+    {
+        return;
+    }
+    IsLoaded = true;
+
+    const int32 NumCues = FMath::Min<int32>(Cues.Num(), InvalidCueId);
+    for (int32 i = 0; i < NumCues; ++i)
+    {
+        USoundBase* Sound = Cast<USoundBase>(Cues[i].TryLoad());
+        if (Sound == nullptr)
+        {
+            UE_LOG(LogTD, Warning, TEXT("Cue %d (%s) isn't a sound."), i,
+                *Cues[i].ToString());
+        }
+        LoadedCues.Emplace(Sound);
+        const float AudibleDistance = Sound != nullptr
+                                          ? Sound->GetMaxDistance()
+                                          : 0.0f;
+        AudibleDistancesSquared.Emplace(FMath::Square(AudibleDistance));
+    }
+}
@@ -0,0 +1,65 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TDCueRegistry.generated.h"
+
+class USoundBase;
+
+/**
+ * @brief The sounds that can be played as replicated cues, listed in
+ * DefaultGame.ini. A cue is sent as its index in the list instead of as an
+ * asset reference, so the list must be the same on the server and clients.
+ */
+UCLASS(Config = Game, DefaultConfig)
+class TD_API UTDCueRegistry : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief The ID of sounds that aren't in the registry.
+     */
+    static constexpr uint8 InvalidCueId = MAX_uint8;
+
+    static UTDCueRegistry* Get();
+
+    /**
+     * @brief Gets the sound's cue ID, or InvalidCueId if it isn't registered.
+     */
+    uint8 GetCueId(const USoundBase* Sound);
+
+    /**
+     * @brief Gets the cue's sound, or nullptr if the ID isn't registered.
+     */
+    USoundBase* GetCue(const uint8 CueId);
+
+    /**
+     * @brief Gets the squared distance that the cue can be heard from, which is
+     * the max distance of its attenuation.
+     */
+    float GetAudibleDistanceSquared(const uint8 CueId);
+
+private:
+    /**
+     * @brief The sounds that can be played as replicated cues. Only append to
+     * it, since the server and clients have to agree on every index.
+     */
+    UPROPERTY(Config)
+    TArray<FSoftObjectPath> Cues;
+
+    UPROPERTY(Transient)
+    TArray<USoundBase*> LoadedCues;
+
+    UPROPERTY(Transient)
+    TArray<float> AudibleDistancesSquared;
+
+    bool IsLoaded = false;
+
+    /**
+     * @brief Loads every cue the first time that one is needed.
+     */
+    void LoadCues();
+};
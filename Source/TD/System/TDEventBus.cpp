@@ -0,0 +1,298 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDEventBus.h"
+
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogTDEventBus, Log, All);
+
+#pragma region Benchmark
+
+namespace
+{
+    DECLARE_MULTICAST_DELEGATE(FBenchmarkRoundEvent);
+
+    /**
+     * @brief Does a trivial amount of work per event so that the calls can't
+     * be optimized away.
+     */
+    struct FBenchmarkSubscriber
+    {
+        uint32 Count = 0;
+
+        void HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
+        {
+            if (Event.OldRoundPhase != Event.RoundPhase)
+            {
+                Count += static_cast<uint8>(Event.RoundPhase);
+            }
+        }
+
+        void HandlePlayerEliminated(const FTDPlayerEliminatedEvent& Event)
+        {
+            Count += Event.IsEliminated ? 1 : 0;
+        }
+
+        void HandleOrbSwapped(const FTDOrbSwappedEvent& Event)
+        {
+            Count += Event.Location.X > 0.0f ? 1 : 0;
+        }
+
+        void HandleScoreChanged(const FTDScoreChangedEvent& Event)
+        {
+            Count += Event.Score;
+        }
+    };
+
+    /**
+     * @brief Stands in for a game state component, which was called through a
+     * virtual method per round phase.
+     */
+    class FBenchmarkComponent
+    {
+    public:
+        virtual ~FBenchmarkComponent() = default;
+
+        virtual void HandleRoundHasStarted()
+        {
+            Count += static_cast<uint8>(ERoundPhase::RoundInProgress);
+        }
+
+        uint32 Count = 0;
+    };
+
+    /**
+     * @brief Stands in for the game state, which switched on the round phase
+     * and looped over its components.
+     */
+    struct FBenchmarkGameState
+    {
+        TArray<FBenchmarkComponent*> Components;
+
+        void HandleRoundHasStarted()
+        {
+            for (FBenchmarkComponent* Component : Components)
+            {
+                Component->HandleRoundHasStarted();
+            }
+        }
+    };
+
+    /**
+     * @brief Stands in for the components that were called directly: the
+     * team state by the player state, the orb state's collision cue and the
+     * UI game state by the score state, which passed every team's score. Not
+     * inlined, since the real calls cross translation units.
+     */
+    struct FBenchmarkDirectListener
+    {
+        uint32 Count = 0;
+        TArray<uint8> TeamScores;
+
+        FORCENOINLINE void HandlePlayerIsEliminatedChanged(
+            const bool IsEliminated)
+        {
+            Count += IsEliminated ? 1 : 0;
+        }
+
+        FORCENOINLINE void PlayOrbCollisionCue(const FVector& Location)
+        {
+            Count += Location.X > 0.0f ? 1 : 0;
+        }
+
+        FORCENOINLINE void SetTeamScores(const TArray<uint8>& NewTeamScores)
+        {
+            if (TeamScores != NewTeamScores)
+            {
+                TeamScores = NewTeamScores;
+                Count += 1;
+            }
+        }
+    };
+
+    /**
+     * @brief Times NumIterations calls of Function and returns the nanoseconds
+     * per call.
+     */
+    template <typename FunctionType>
+    double TimeNanoseconds(const int32 NumIterations, FunctionType Function)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumIterations; ++i)
+        {
+            Function(i);
+        }
+        return (FPlatformTime::Seconds() - StartTime) * 1.0e9 / NumIterations;
+    }
+
+    /**
+     * @brief Compares each event published through the event bus with the
+     * calls that it replaced:
+     * - A round phase change, against the round state machine's multicast
+     *   event to the game mode and the round state's multicast event to the
+     *   game state, which called each of its components through a virtual
+     *   method. Both have the game mode, the game state and the same number
+     *   of components listening.
+     * - A player elimination, an orb swap and a score change, each against a
+     *   direct call into the one component that handles it.
+     * Usage: TD.BenchmarkEventBus [Components] [Iterations]
+     */
+    void BenchmarkEventBus(const TArray<FString>& Args)
+    {
+        const int32 NumComponents = Args.Num() > 0
+                                        ? FCString::Atoi(*Args[0])
+                                        : 4;
+        const int32 NumIterations = Args.Num() > 1
+                                        ? FCString::Atoi(*Args[1])
+                                        : 1000000;
+        if (NumComponents < 0 || NumIterations <= 0)
+        {
+            UE_LOG(LogTDEventBus, Warning,
+                TEXT("Usage: TD.BenchmarkEventBus [Components] [Iterations]"));
+            return;
+        }
+
+        // The game mode, the game state and the components.
+        TArray<FBenchmarkSubscriber> Subscribers;
+        Subscribers.SetNum(NumComponents + 2);
+        FTDEventBus EventBus;
+        for (FBenchmarkSubscriber& Subscriber : Subscribers)
+        {
+            EventBus.Subscribe<FTDPhaseChangedEvent, FBenchmarkSubscriber,
+                &FBenchmarkSubscriber::HandlePhaseChanged>(&Subscriber);
+        }
+        // The team state, the orb state and the UI game state.
+        FBenchmarkSubscriber EventSubscriber;
+        EventBus.Subscribe<FTDPlayerEliminatedEvent, FBenchmarkSubscriber,
+            &FBenchmarkSubscriber::HandlePlayerEliminated>(&EventSubscriber);
+        EventBus.Subscribe<FTDOrbSwappedEvent, FBenchmarkSubscriber,
+            &FBenchmarkSubscriber::HandleOrbSwapped>(&EventSubscriber);
+        EventBus.Subscribe<FTDScoreChangedEvent, FBenchmarkSubscriber,
+            &FBenchmarkSubscriber::HandleScoreChanged>(&EventSubscriber);
+
+        TArray<FBenchmarkComponent> Components;
+        Components.SetNum(NumComponents);
+        FBenchmarkGameState GameState;
+        for (FBenchmarkComponent& Component : Components)
+        {
+            GameState.Components.Emplace(&Component);
+        }
+        FBenchmarkComponent GameMode;
+        FBenchmarkRoundEvent StateMachineEvent;
+        StateMachineEvent.AddRaw(&GameMode,
+            &FBenchmarkComponent::HandleRoundHasStarted);
+        FBenchmarkRoundEvent RoundStateEvent;
+        RoundStateEvent.AddRaw(&GameState,
+            &FBenchmarkGameState::HandleRoundHasStarted);
+        FBenchmarkDirectListener DirectListener;
+
+        FTDPhaseChangedEvent Event;
+        Event.OldRoundPhase = ERoundPhase::WaitingPreRound;
+        Event.RoundPhase = ERoundPhase::RoundInProgress;
+
+        const double EventBusPhaseNs = TimeNanoseconds(NumIterations,
+            [&](const int32)
+            {
+                EventBus.Broadcast(Event);
+            });
+        const double ChainPhaseNs = TimeNanoseconds(NumIterations,
+            [&](const int32)
+            {
+                switch (Event.RoundPhase)
+                {
+                case ERoundPhase::RoundInProgress:
+                    RoundStateEvent.Broadcast();
+                    StateMachineEvent.Broadcast();
+                    break;
+                default:
+                    break;
+                }
+            });
+
+        const double EventBusEliminatedNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                EventBus.Broadcast(
+                    FTDPlayerEliminatedEvent{nullptr, i % 2 == 0});
+            });
+        const double DirectEliminatedNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                DirectListener.HandlePlayerIsEliminatedChanged(i % 2 == 0);
+            });
+
+        const double EventBusSwappedNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                EventBus.Broadcast(FTDOrbSwappedEvent{nullptr, nullptr,
+                    FVector(static_cast<float>(i))});
+            });
+        const double DirectSwappedNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                DirectListener.PlayOrbCollisionCue(
+                    FVector(static_cast<float>(i)));
+            });
+
+        // The score state passed all of its scores for every change.
+        TArray<uint8> TeamScores;
+        for (const ETeamIndex Index : TEnumRange<ETeamIndex>())
+        {
+            TeamScores.Emplace(0);
+        }
+        const ETeamIndex ScoredTeam = ETeamIndex::Blue;
+        const double EventBusScoreNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                EventBus.Broadcast(FTDScoreChangedEvent{ScoredTeam,
+                    static_cast<uint8>(i)});
+            });
+        const double DirectScoreNs = TimeNanoseconds(NumIterations,
+            [&](const int32 i)
+            {
+                TeamScores[Int(ScoredTeam)] = static_cast<uint8>(i);
+                DirectListener.SetTeamScores(TeamScores);
+            });
+
+        uint32 Checksum = GameMode.Count + EventSubscriber.Count +
+                          DirectListener.Count;
+        for (const FBenchmarkSubscriber& Subscriber : Subscribers)
+        {
+            Checksum += Subscriber.Count;
+        }
+        for (const FBenchmarkComponent& Component : Components)
+        {
+            Checksum += Component.Count;
+        }
+
+        UE_LOG(LogTDEventBus, Log,
+            TEXT("%d components, %d events of each type (checksum %u)"),
+            NumComponents, NumIterations, Checksum);
+        UE_LOG(LogTDEventBus, Log,
+            TEXT("Phase changed: event bus %.2f ns, round events and "
+                "component loop %.2f ns"),
+            EventBusPhaseNs, ChainPhaseNs);
+        UE_LOG(LogTDEventBus, Log,
+            TEXT("Player eliminated: event bus %.2f ns, direct call %.2f ns"),
+            EventBusEliminatedNs, DirectEliminatedNs);
+        UE_LOG(LogTDEventBus, Log,
+            TEXT("Orb swapped: event bus %.2f ns, direct call %.2f ns"),
+            EventBusSwappedNs, DirectSwappedNs);
+        UE_LOG(LogTDEventBus, Log,
+            TEXT("Score changed: event bus %.2f ns, every team's scores "
+                "%.2f ns"),
+            EventBusScoreNs, DirectScoreNs);
+    }
+
+    FAutoConsoleCommand BenchmarkEventBusCommand(
+        TEXT("TD.BenchmarkEventBus"),
+        TEXT("Compares the event bus with the calls it replaced. "
+            "Usage: TD.BenchmarkEventBus [Components] [Iterations]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkEventBus));
+}
+
+#pragma endregion
+
+#endif
@@ -0,0 +1,222 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+/**
+ * This file is for the typed gameplay event bus and its events.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TDTypes.h"
+
+class AOrb;
+class ATDPlayerState;
+
+#pragma region Events
+
+/**
+ * @brief The match or round phase changed.
+ */
+struct FTDPhaseChangedEvent
+{
+    EMatchPhase OldMatchPhase = EMatchPhase::None;
+    EMatchPhase MatchPhase = EMatchPhase::None;
+    ERoundPhase OldRoundPhase = ERoundPhase::None;
+    ERoundPhase RoundPhase = ERoundPhase::None;
+    uint16 RoundNumber = 0;
+};
+
+/**
+ * @brief A player was eliminated, or brought back for the next round. Only
+ * published on the server.
+ */
+struct FTDPlayerEliminatedEvent
+{
+    ATDPlayerState* Player = nullptr;
+    bool IsEliminated = true;
+};
+
+/**
+ * @brief Two orbs collided and swapped teams. Only published on the server.
+ */
+struct FTDOrbSwappedEvent
+{
+    AOrb* InstigatorOrb = nullptr;
+    AOrb* HitOrb = nullptr;
+    FVector Location = FVector::ZeroVector;
+};
+
+/**
+ * @brief A team's score changed, on the server or once it has replicated.
+ */
+struct FTDScoreChangedEvent
+{
+    ETeamIndex Team = ETeamIndex::None;
+    uint8 Score = 0;
+};
+
+#pragma endregion
+
+#pragma region Event Channel
+
+/**
+ * @brief A flat list of subscribers to a single event type. Subscribers are
+ * called in ascending priority, then in the order they subscribed. The handler
+ * is bound at compile time through a template thunk, so dispatching is a loop
+ * of plain function pointer calls with no allocation.
+ *
+ * Subscribers aren't weakly referenced; they must unsubscribe before they're
+ * destroyed.
+ */
+template <typename EventType>
+class TTDEventChannel
+{
+public:
+    /**
+     * @brief Subscribes a handler to the event.
+     * @param Subscriber The object that Method is called on.
+     * @param Priority Lower priorities are called first.
+     */
+    template <typename SubscriberType,
+              void (SubscriberType::*Method)(const EventType&)>
+    void Subscribe(SubscriberType* Subscriber, const int32 Priority = 0)
+    {
+        FSubscriber NewSubscriber;
+        NewSubscriber.Object = Subscriber;
+        NewSubscriber.Handler = &Thunk<SubscriberType, Method>;
+        NewSubscriber.Priority = Priority;
+
+        int32 Index = Subscribers.Num();
+        while (Index > 0 && Subscribers[Index - 1].Priority > Priority)
+        {
+            Index -= 1;
+        }
+        Subscribers.Insert(NewSubscriber, Index);
+        if (BroadcastIndex != INDEX_NONE && Index <= BroadcastIndex)
+        {
+            BroadcastIndex += 1;
+        }
+    }
+
+    /**
+     * @brief Unsubscribes all of the subscriber's handlers. Safe to call while
+     * the event is being broadcast, as is subscribing.
+     */
+    void Unsubscribe(const void* Subscriber)
+    {
+        for (int32 Index = Subscribers.Num() - 1; Index >= 0; --Index)
+        {
+            if (Subscribers[Index].Object == Subscriber)
+            {
+                Subscribers.RemoveAt(Index, 1, false);
+                if (BroadcastIndex != INDEX_NONE && Index <= BroadcastIndex)
+                {
+                    BroadcastIndex -= 1;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls every subscriber with the event.
+     */
+    void Broadcast(const EventType& Event)
+    {
+        // An index instead of an iterator so subscribers can unsubscribe
+        // while the event is being broadcast.
+        const int32 PreviousBroadcastIndex = BroadcastIndex;
+        for (BroadcastIndex = 0; BroadcastIndex < Subscribers.Num();
+             ++BroadcastIndex)
+        {
+            const FSubscriber& Subscriber = Subscribers[BroadcastIndex];
+            Subscriber.Handler(Subscriber.Object, Event);
+        }
+        BroadcastIndex = PreviousBroadcastIndex;
+    }
+
+    int32 Num() const
+    {
+        return Subscribers.Num();
+    }
+
+private:
+    using FHandler = void(*)(void*, const EventType&);
+
+    struct FSubscriber
+    {
+        void* Object = nullptr;
+        FHandler Handler = nullptr;
+        int32 Priority = 0;
+    };
+
+    template <typename SubscriberType,
+              void (SubscriberType::*Method)(const EventType&)>
+    static void Thunk(void* Object, const EventType& Event)
+    {
+        (static_cast<SubscriberType*>(Object)->*Method)(Event);
+    }
+
+    TArray<FSubscriber, TInlineAllocator<8>> Subscribers;
+
+    /**
+     * @brief The index of the subscriber being called, or INDEX_NONE if the
+     * event isn't being broadcast.
+     */
+    int32 BroadcastIndex = INDEX_NONE;
+};
+
+#pragma endregion
+
+#pragma region Event Bus
+
+/**
+ * @brief One channel per TD gameplay event. The channel is picked by the event
+ * type at compile time. An event is added by declaring it above, then adding
+ * its channel as a base and to UnsubscribeAll.
+ *
+ * Usage:
+ *     EventBus.Subscribe<FTDPhaseChangedEvent, UMyClass,
+ *         &UMyClass::HandlePhaseChanged>(this);
+ *     EventBus.Broadcast(FTDPhaseChangedEvent{...});
+ */
+class TD_API FTDEventBus :
+    private TTDEventChannel<FTDPhaseChangedEvent>,
+    private TTDEventChannel<FTDPlayerEliminatedEvent>,
+    private TTDEventChannel<FTDOrbSwappedEvent>,
+    private TTDEventChannel<FTDScoreChangedEvent>
+{
+public:
+    template <typename EventType>
+    TTDEventChannel<EventType>& GetChannel()
+    {
+        return static_cast<TTDEventChannel<EventType>&>(*this);
+    }
+
+    template <typename EventType, typename SubscriberType,
+              void (SubscriberType::*Method)(const EventType&)>
+    void Subscribe(SubscriberType* Subscriber, const int32 Priority = 0)
+    {
+        GetChannel<EventType>().template Subscribe<SubscriberType, Method>(
+            Subscriber, Priority);
+    }
+
+    /**
+     * @brief Unsubscribes the subscriber from every event.
+     */
+    void UnsubscribeAll(const void* Subscriber)
+    {
+        GetChannel<FTDPhaseChangedEvent>().Unsubscribe(Subscriber);
+        GetChannel<FTDPlayerEliminatedEvent>().Unsubscribe(Subscriber);
+        GetChannel<FTDOrbSwappedEvent>().Unsubscribe(Subscriber);
+        GetChannel<FTDScoreChangedEvent>().Unsubscribe(Subscriber);
+    }
+
+    template <typename EventType>
+    void Broadcast(const EventType& Event)
+    {
+        GetChannel<EventType>().Broadcast(Event);
+    }
+};
+
+#pragma endregion
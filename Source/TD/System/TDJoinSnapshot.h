@@ -0,0 +1,98 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+/**
+ * This file is for the state that's sent to players that join a match in
+ * progress before anything else.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "TDTypes.h"
+#include "Engine/NetSerialization.h"
+#include "TDJoinSnapshot.generated.h"
+
+/**
+ * @brief A player's team membership at the time the snapshot was taken.
+ */
+USTRUCT(BlueprintType)
+struct TD_API FTDJoinSnapshotPlayer
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 PlayerId = INDEX_NONE;
+
+    UPROPERTY(BlueprintReadOnly)
+    FString PlayerName;
+
+    UPROPERTY(BlueprintReadOnly)
+    ETeamIndex Team = ETeamIndex::None;
+
+    UPROPERTY(BlueprintReadOnly)
+    bool IsEliminated = false;
+};
+
+/**
+ * @brief The state that a player joining a match in progress needs in order to
+ * play, sent in a single reliable RPC ahead of the initial replication of every
+ * actor. Orbs aren't included: they're replicated as they come into the
+ * player's view, nearest first. @see UTDReplicationGraph
+ *
+ * Timers are rebased so that they're relative to when the snapshot was taken:
+ * the client sets their start time to its own clock when it's received, since
+ * its server clock isn't synchronized yet. @see FTDJoinSnapshot::Rebase
+ */
+USTRUCT(BlueprintType)
+struct TD_API FTDJoinSnapshot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FMatchRoundState MatchRoundState;
+
+    UPROPERTY(BlueprintReadOnly)
+    FReplicatedTimer MatchTimer;
+
+    UPROPERTY(BlueprintReadOnly)
+    FReplicatedTimer RoundStartTimer;
+
+    UPROPERTY(BlueprintReadOnly)
+    FReplicatedTimer MatchRestartTimer;
+
+    UPROPERTY(BlueprintReadOnly)
+    TArray<uint8> TeamScores;
+
+    UPROPERTY(BlueprintReadOnly)
+    TArray<FTDJoinSnapshotPlayer> Players;
+
+    /**
+     * @brief Sets each timer's seconds to its seconds at ServerTime and its
+     * start time to 0 so that it can be restarted from any clock.
+     */
+    void Rebase(const float ServerTime)
+    {
+        RebaseTimer(MatchTimer, ServerTime);
+        RebaseTimer(RoundStartTimer, ServerTime);
+        RebaseTimer(MatchRestartTimer, ServerTime);
+    }
+
+    /**
+     * @brief Sets each running timer's start time to the local time that the
+     * snapshot was received at.
+     */
+    void StartTimers(const float LocalTime)
+    {
+        MatchTimer.StartServerTime = LocalTime;
+        RoundStartTimer.StartServerTime = LocalTime;
+        MatchRestartTimer.StartServerTime = LocalTime;
+    }
+
+private:
+    static void RebaseTimer(FReplicatedTimer& Timer, const float ServerTime)
+    {
+        Timer.Seconds = Timer.GetSeconds(ServerTime);
+        Timer.StartServerTime = 0.0f;
+    }
+};
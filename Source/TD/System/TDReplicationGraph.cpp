@@ -0,0 +1,383 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDReplicationGraph.h"
+
+#include "TDWorldRegistry.h"
+#include "Arena/TeamPlayerStart.h"
+#include "Engine/NetDriver.h"
+#include "Engine/SimulatedClientNetConnection.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "GameFramework/SpectatorPawn.h"
+#include "GameRules/GameRules.h"
+#include "GameState/TDGameState.h"
+#include "HAL/IConsoleManager.h"
+#include "Orb/Orb.h"
+#include "Player/TDCharacter.h"
+#include "UObject/UObjectIterator.h"
+
+#pragma region Initialization
+
+void UTDReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    ClassRepNodePolicies.Set(ATDGameState::StaticClass(),
+        ETDClassRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(AGameRules::StaticClass(),
+        ETDClassRepNodeMapping::RelevantAllConnections);
+    // Every player needs every player state for the team rosters.
+    ClassRepNodePolicies.Set(APlayerState::StaticClass(),
+        ETDClassRepNodeMapping::RelevantAllConnections);
+    ClassRepNodePolicies.Set(APlayerController::StaticClass(),
+        ETDClassRepNodeMapping::NotRouted);
+    ClassRepNodePolicies.Set(AOrb::StaticClass(),
+        ETDClassRepNodeMapping::Spatialize_Dynamic);
+    // Eliminated characters go dormant until they're reactivated.
+    ClassRepNodePolicies.Set(ATDCharacter::StaticClass(),
+        ETDClassRepNodeMapping::Spatialize_Dormancy);
+
+    const float MaxTickRate = NetDriver->NetServerMaxTickRate;
+    for (TObjectIterator<UClass> It; It; ++It)
+    {
+        UClass* Class = *It;
+        const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+        if (ActorCDO == nullptr || !ActorCDO->GetIsReplicated() ||
+            Class->GetName().StartsWith(TEXT("SKEL_")) ||
+            Class->GetName().StartsWith(TEXT("REINST_")))
+        {
+            continue;
+        }
+
+        FClassReplicationInfo ClassInfo;
+        ClassInfo.ReplicationPeriodFrame = FMath::Max<uint32>(
+            FMath::RoundToInt(MaxTickRate /
+                              FMath::Max(ActorCDO->NetUpdateFrequency, 1.0f)),
+            1);
+        if (GetMappingPolicy(Class) >=
+            ETDClassRepNodeMapping::Spatialize_Static)
+        {
+            ClassInfo.SetCullDistanceSquared(ActorCDO->NetCullDistanceSquared);
+        }
+        GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+    }
+}
+
+void UTDReplicationGraph::InitGlobalGraphNodes()
+{
+    Super::InitGlobalGraphNodes();
+
+    GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+    GridNode->CellSize = GridCellSize;
+    GridNode->SpatialBias = SpatialBias;
+    AddGlobalGraphNode(GridNode);
+
+    AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+    AddGlobalGraphNode(AlwaysRelevantNode);
+}
+
+void UTDReplicationGraph::InitConnectionGraphNodes(
+    UNetReplicationGraphConnection* RepGraphConnection)
+{
+    Super::InitConnectionGraphNodes(RepGraphConnection);
+
+    AddConnectionGraphNode(
+        CreateNewNode<UTDReplicationGraphNode_AlwaysRelevant_ForConnection>(),
+        RepGraphConnection);
+}
+
+ETDClassRepNodeMapping UTDReplicationGraph::GetMappingPolicyForClass(
+    const UClass* Class)
+{
+    const AActor* ActorCDO = Class->GetDefaultObject<AActor>();
+    if (ActorCDO->bOnlyRelevantToOwner)
+    {
+        return ETDClassRepNodeMapping::NotRouted;
+    }
+    if (ActorCDO->bAlwaysRelevant || ActorCDO->GetRootComponent() == nullptr)
+    {
+        return ETDClassRepNodeMapping::RelevantAllConnections;
+    }
+    if (ActorCDO->NetDormancy >= DORM_DormantAll)
+    {
+        return ETDClassRepNodeMapping::Spatialize_Dormancy;
+    }
+    return ActorCDO->IsReplicatingMovement()
+               ? ETDClassRepNodeMapping::Spatialize_Dynamic
+               : ETDClassRepNodeMapping::Spatialize_Static;
+}
+
+#pragma endregion
+
+#pragma region Routing
+
+void UTDReplicationGraph::RouteAddNetworkActorToNodes(
+    const FNewReplicatedActorInfo& ActorInfo,
+    FGlobalActorReplicationInfo& GlobalInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ETDClassRepNodeMapping::RelevantAllConnections:
+        AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Static:
+        GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Dynamic:
+        GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Dormancy:
+        GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+        break;
+    default:
+        break;
+    }
+}
+
+void UTDReplicationGraph::RouteRemoveNetworkActorToNodes(
+    const FNewReplicatedActorInfo& ActorInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ETDClassRepNodeMapping::RelevantAllConnections:
+        AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Static:
+        GridNode->RemoveActor_Static(ActorInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Dynamic:
+        GridNode->RemoveActor_Dynamic(ActorInfo);
+        break;
+    case ETDClassRepNodeMapping::Spatialize_Dormancy:
+        GridNode->RemoveActor_Dormancy(ActorInfo);
+        break;
+    default:
+        break;
+    }
+}
+
+ETDClassRepNodeMapping UTDReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+    const ETDClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(Class);
+    return Policy != nullptr ? *Policy : GetMappingPolicyForClass(Class);
+}
+
+#pragma endregion
+
+#pragma region Connection Node
+
+void UTDReplicationGraphNode_AlwaysRelevant_ForConnection::
+GatherActorListsForConnection(
+    const FConnectionGatherActorListParameters& Params)
+{
+    ConnectionActors.Reset();
+    for (const FNetViewer& Viewer : Params.Viewers)
+    {
+        if (Viewer.InViewer != nullptr)
+        {
+            ConnectionActors.ConditionalAdd(Viewer.InViewer);
+            if (Viewer.InViewer->PlayerState != nullptr)
+            {
+                ConnectionActors.ConditionalAdd(Viewer.InViewer->PlayerState);
+            }
+        }
+        if (Viewer.ViewTarget != nullptr)
+        {
+            ConnectionActors.ConditionalAdd(Viewer.ViewTarget);
+        }
+    }
+    Params.OutGatheredReplicationLists.AddReplicationActorList(
+        ConnectionActors);
+}
+
+#pragma endregion
+
+#if !UE_BUILD_SHIPPING && WITH_SERVER_CODE
+
+DEFINE_LOG_CATEGORY_STATIC(LogTDReplicationGraph, Log, All);
+
+#pragma region Benchmark
+
+namespace
+{
+    /**
+     * @brief Spawns orbs at random around the team player starts until there
+     * are NumOrbs orbs.
+     */
+    void SpawnBenchmarkOrbs(UWorld* World, const int32 NumOrbs)
+    {
+        UTDWorldRegistry* Registry = UTDWorldRegistry::Get(World);
+        FBox Bounds(ForceInit);
+        for (const ATeamPlayerStart* PlayerStart :
+             Registry->GetTeamPlayerStarts())
+        {
+            Bounds += PlayerStart->GetActorLocation();
+        }
+        if (!Bounds.IsValid)
+        {
+            Bounds = FBox(FVector::ZeroVector, FVector::ZeroVector);
+        }
+        Bounds = Bounds.ExpandBy(FVector(1000.0f, 1000.0f, 200.0f));
+
+        const TArray<AOrb*>& Orbs = Registry->GetOrbs();
+        UClass* OrbClass = Orbs.Num() > 0
+                               ? Orbs[0]->GetClass()
+                               : AOrb::StaticClass();
+        FActorSpawnParameters SpawnParameters;
+        SpawnParameters.SpawnCollisionHandlingOverride =
+            ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        while (Orbs.Num() < NumOrbs)
+        {
+            if (World->SpawnActor<AOrb>(OrbClass, FMath::RandPointInBox(Bounds),
+                FRotator::ZeroRotator, SpawnParameters) == nullptr)
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief A connection that absorbs what's sent to it, and the spectator
+     * that it views the arena from.
+     */
+    struct FBenchmarkConnection
+    {
+        USimulatedClientNetConnection* Connection = nullptr;
+        ASpectatorPawn* Viewer = nullptr;
+    };
+
+    /**
+     * @brief Adds simulated connections until the net driver has
+     * NumConnections client connections. Each one views the arena from a
+     * spectator at one of the team player starts, so the replication pass
+     * gathers and prioritizes for it as it would for a real client.
+     */
+    TArray<FBenchmarkConnection> AddBenchmarkConnections(UWorld* World,
+        UNetDriver* NetDriver, const int32 NumConnections)
+    {
+        TArray<FBenchmarkConnection> Connections;
+        const TArray<ATeamPlayerStart*>& PlayerStarts =
+            UTDWorldRegistry::Get(World)->GetTeamPlayerStarts();
+        FActorSpawnParameters SpawnParameters;
+        SpawnParameters.SpawnCollisionHandlingOverride =
+            ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        while (NetDriver->ClientConnections.Num() < NumConnections)
+        {
+            FVector Location = FVector::ZeroVector;
+            if (PlayerStarts.Num() > 0)
+            {
+                Location = PlayerStarts[Connections.Num() %
+                    PlayerStarts.Num()]->GetActorLocation();
+            }
+            ASpectatorPawn* Viewer = World->SpawnActor<ASpectatorPawn>(
+                Location, FRotator::ZeroRotator, SpawnParameters);
+            if (Viewer == nullptr)
+            {
+                break;
+            }
+
+            USimulatedClientNetConnection* Connection =
+                NewObject<USimulatedClientNetConnection>();
+            Connection->InitConnection(NetDriver, USOCK_Open, World->URL,
+                1000000);
+            Connection->SetClientWorldPackageName(
+                World->GetOutermost()->GetFName());
+            Connection->SetClientLoginState(EClientLoginState::Welcomed);
+            Connection->OwningActor = Viewer;
+            Connection->ViewTarget = Viewer;
+            NetDriver->AddClientConnection(Connection);
+            Connections.Add({Connection, Viewer});
+        }
+        return Connections;
+    }
+
+    /**
+     * @brief Closes the simulated connections and destroys their spectators.
+     */
+    void RemoveBenchmarkConnections(
+        const TArray<FBenchmarkConnection>& Connections)
+    {
+        for (const FBenchmarkConnection& Connection : Connections)
+        {
+            Connection.Connection->CleanUp();
+            Connection.Viewer->Destroy();
+        }
+    }
+
+    /**
+     * @brief Tops the world up to the number of orbs, then runs the server's
+     * replication pass for the number of frames back to back and logs the
+     * average time per pass. Connected clients are topped up to the number
+     * of connections with simulated ones, which are removed afterwards. Run
+     * it once with the replication graph and once with
+     * ReplicationDriverClassName cleared to compare.
+     * Usage: TD.BenchmarkReplication [Orbs] [Frames] [Connections]
+     */
+    void BenchmarkReplication(const TArray<FString>& Args, UWorld* World)
+    {
+        const int32 NumOrbs = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+        const int32 NumFrames = Args.Num() > 1
+                                    ? FCString::Atoi(*Args[1])
+                                    : 300;
+        const int32 NumConnections = Args.Num() > 2
+                                         ? FCString::Atoi(*Args[2])
+                                         : 32;
+        UNetDriver* NetDriver = World != nullptr
+                                    ? World->GetNetDriver()
+                                    : nullptr;
+        if (NetDriver == nullptr || !NetDriver->IsServer() || NumOrbs < 0 ||
+            NumFrames <= 0 || NumConnections < 0)
+        {
+            UE_LOG(LogTDReplicationGraph, Warning,
+                TEXT("Usage (on a server): TD.BenchmarkReplication "
+                    "[Orbs] [Frames] [Connections]"));
+            return;
+        }
+
+        SpawnBenchmarkOrbs(World, NumOrbs);
+        const TArray<FBenchmarkConnection> Connections =
+            AddBenchmarkConnections(World, NetDriver, NumConnections);
+
+        const float DeltaSeconds = 1.0f / NetDriver->NetServerMaxTickRate;
+        int32 NumReplicated = 0;
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 i = 0; i < NumFrames; ++i)
+        {
+            // Simulated connections never tick, so their bandwidth is reset
+            // to keep them from saturating after the first few passes.
+            for (const FBenchmarkConnection& Connection : Connections)
+            {
+                Connection.Connection->QueuedBits = 0;
+            }
+            NumReplicated += NetDriver->ServerReplicateActors(DeltaSeconds);
+        }
+        const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+        const UReplicationDriver* ReplicationDriver =
+            NetDriver->GetReplicationDriver();
+        UE_LOG(LogTDReplicationGraph, Log,
+            TEXT("%s: %d connections, %d orbs, %d actors replicated per pass"),
+            ReplicationDriver != nullptr
+            ? *ReplicationDriver->GetClass()->GetName()
+            : TEXT("Default replication"),
+            NetDriver->ClientConnections.Num(),
+            UTDWorldRegistry::Get(World)->GetOrbs().Num(),
+            NumReplicated / NumFrames);
+        UE_LOG(LogTDReplicationGraph, Log, TEXT("%.3f ms per pass"),
+            Seconds * 1000.0 / NumFrames);
+
+        RemoveBenchmarkConnections(Connections);
+    }
+
+    FAutoConsoleCommandWithWorldAndArgs BenchmarkReplicationCommand(
+        TEXT("TD.BenchmarkReplication"),
+        TEXT("Times the server's replication pass, topping the clients up "
+            "with simulated connections. "
+            "Usage: TD.BenchmarkReplication [Orbs] [Frames] [Connections]"),
+        FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+            &BenchmarkReplication));
+}
+
+#pragma endregion
+
+#endif
@@ -0,0 +1,162 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+/**
+ * This file is for the replication graph that decides which actors are
+ * considered for replication to each connection.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ReplicationGraph.h"
+#include "TDReplicationGraph.generated.h"
+
+/**
+ * @brief How actors of a class are routed to the replication graph's nodes.
+ */
+UENUM()
+enum class ETDClassRepNodeMapping : uint8
+{
+    /**
+     * @brief Not routed to a global node. Owner-only actors, such as player
+     * controllers, are gathered by the connection's node instead.
+     */
+    NotRouted,
+
+    /**
+     * @brief Replicated to every connection, such as the game state, game
+     * rules and player states.
+     */
+    RelevantAllConnections,
+
+    /**
+     * @brief Spatialized actors that don't move, such as arena actors.
+     */
+    Spatialize_Static,
+
+    /**
+     * @brief Spatialized actors that move every frame, such as orbs.
+     */
+    Spatialize_Dynamic,
+
+    /**
+     * @brief Spatialized actors that are treated as static while they're
+     * dormant, such as deactivated characters.
+     */
+    Spatialize_Dormancy,
+};
+
+/**
+ * @brief Replaces the net driver's default pass, which checks the relevancy of
+ * every replicated actor for every connection, with a graph tailored to TD:
+ * - An always relevant node for the game state, game rules and player states.
+ * - A node per connection for its player controller, player state and pawn.
+ * - A spatial grid for orbs and characters, so each connection only gathers
+ *   the actors in the cells around it, which also holds dormant arena actors.
+ *
+ * The spatial grid is updated once per frame instead of once per connection,
+ * so the cost of a frame scales with the connections rather than with the
+ * connections times the actors.
+ *
+ * Enabled through ReplicationDriverClassName in DefaultEngine.ini.
+ * @see TD.BenchmarkReplication
+ */
+UCLASS(Transient, Config = Engine)
+class TD_API UTDReplicationGraph : public UReplicationGraph
+{
+    GENERATED_BODY()
+
+#pragma region Initialization
+
+public:
+    /**
+     * @brief Maps every replicated class to a node and sets its replication
+     * period and cull distance from its default object.
+     */
+    virtual void InitGlobalActorClassSettings() override;
+
+    /**
+     * @brief Creates the spatial grid and the always relevant node.
+     */
+    virtual void InitGlobalGraphNodes() override;
+
+    /**
+     * @brief Creates the connection's node.
+     */
+    virtual void InitConnectionGraphNodes(
+        UNetReplicationGraphConnection* RepGraphConnection) override;
+
+private:
+    /**
+     * @brief Gets how actors of the class should be routed from its default
+     * object.
+     */
+    static ETDClassRepNodeMapping GetMappingPolicyForClass(const UClass* Class);
+
+#pragma endregion
+
+#pragma region Routing
+
+public:
+    virtual void RouteAddNetworkActorToNodes(
+        const FNewReplicatedActorInfo& ActorInfo,
+        FGlobalActorReplicationInfo& GlobalInfo) override;
+
+    virtual void RouteRemoveNetworkActorToNodes(
+        const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+    /**
+     * @brief Gets the routing of the actor's class, which inherits the routing
+     * of its closest mapped super class.
+     */
+    ETDClassRepNodeMapping GetMappingPolicy(UClass* Class);
+
+    TClassMap<ETDClassRepNodeMapping> ClassRepNodePolicies;
+
+#pragma endregion
+
+#pragma region Nodes
+
+protected:
+    /**
+     * @brief The size of a spatial grid cell in cm.
+     */
+    UPROPERTY(Config)
+    float GridCellSize = 5000.0f;
+
+    /**
+     * @brief Offsets the spatial grid so that the arena is in positive
+     * coordinates.
+     */
+    UPROPERTY(Config)
+    FVector2D SpatialBias = FVector2D(-50000.0f, -50000.0f);
+
+private:
+    UPROPERTY()
+    UReplicationGraphNode_GridSpatialization2D* GridNode = nullptr;
+
+    UPROPERTY()
+    UReplicationGraphNode_ActorList* AlwaysRelevantNode = nullptr;
+
+#pragma endregion
+};
+
+/**
+ * @brief Gathers each of the connection's viewers' player controller, player
+ * state and view target, so that they're always relevant to their owner.
+ */
+UCLASS()
+class TD_API UTDReplicationGraphNode_AlwaysRelevant_ForConnection :
+    public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+    GENERATED_BODY()
+
+public:
+    virtual void GatherActorListsForConnection(
+        const FConnectionGatherActorListParameters& Params) override;
+
+private:
+    FActorRepListRefView ConnectionActors;
+};
@@ -0,0 +1,224 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDRewindHistory.h"
+
+#include "GameConfiguration.h"
+#include "TDWorldRegistry.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "Orb/Orb.h"
+#include "Player/TDCharacter.h"
+
+UTDRewindHistory* UTDRewindHistory::Get(const UObject* WorldContextObject)
+{
+    const UWorld* const World = WorldContextObject != nullptr
+                                    ? WorldContextObject->GetWorld()
+                                    : nullptr;
+    return World != nullptr ? World->GetSubsystem<UTDRewindHistory>() : nullptr;
+}
+
+#pragma region Tick
+
+namespace
+{
+    void AddSample(TArray<FTDRewindSample>& Samples, AActor* Actor)
+    {
+        float Radius;
+        float HalfHeight;
+        Actor->GetSimpleCollisionCylinder(Radius, HalfHeight);
+
+        FTDRewindSample& Sample = Samples.AddDefaulted_GetRef();
+        Sample.Actor = Actor;
+        Sample.Location = Actor->GetActorLocation();
+        Sample.BoundsRadius = FVector2D(Radius, HalfHeight).Size();
+    }
+}
+
+void UTDRewindHistory::Tick(float DeltaTime)
+{
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    if (Registry == nullptr)
+    {
+        LogInvalidPointer("UTDRewindHistory", "Tick", "Registry");
+        return;
+    }
+
+    const int32 Capacity = FMath::Max(MaxFrames, 2);
+    if (Frames.Num() != Capacity)
+    {
+        Frames.SetNum(Capacity);
+        NewestFrame = INDEX_NONE;
+        NumFrames = 0;
+    }
+
+    // Overwrites the oldest frame, reusing its samples' allocation.
+    NewestFrame = (NewestFrame + 1) % Capacity;
+    NumFrames = FMath::Min(NumFrames + 1, Capacity);
+    FTDRewindFrame& Frame = Frames[NewestFrame];
+    Frame.Time = GetWorld()->GetTimeSeconds();
+    Frame.Samples.Reset();
+    for (AOrb* Orb : Registry->GetOrbs())
+    {
+        AddSample(Frame.Samples, Orb);
+    }
+    for (ATDCharacter* Character : Registry->GetCharacters())
+    {
+        // Eliminated characters are hidden without collision until they're
+        // reactivated.
+        if (!Character->GetIsDeactivated())
+        {
+            AddSample(Frame.Samples, Character);
+        }
+    }
+}
+
+bool UTDRewindHistory::IsTickable() const
+{
+    const UWorld* World = GetWorld();
+    return !IsTemplate() && World != nullptr &&
+        (World->GetNetMode() == NM_DedicatedServer ||
+            World->GetNetMode() == NM_ListenServer);
+}
+
+UWorld* UTDRewindHistory::GetTickableGameObjectWorld() const
+{
+    return GetWorld();
+}
+
+TStatId UTDRewindHistory::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTDRewindHistory, STATGROUP_Tickables);
+}
+
+#pragma endregion
+
+#pragma region Rewind
+
+float UTDRewindHistory::GetRewindSeconds(
+    const APlayerState* PlayerState) const
+{
+    if (PlayerState == nullptr)
+    {
+        return 0.0f;
+    }
+
+    // ExactPing is the round trip in milliseconds.
+    const float Seconds = PlayerState->ExactPing * 0.0005f +
+        InterpolationSeconds;
+    return FMath::Clamp(Seconds, 0.0f, MaxRewindSeconds);
+}
+
+bool UTDRewindHistory::LineTraceTelekinetic(FHitResult& Hit,
+    const FVector& Start, const FVector& End, const float RewindSeconds,
+    const AActor* IgnoredActor) const
+{
+    UWorld* World = GetWorld();
+    if (World == nullptr)
+    {
+        LogInvalidPointer("UTDRewindHistory", "LineTraceTelekinetic",
+            "World");
+        return false;
+    }
+
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(IgnoredActor);
+    if (NumFrames == 0 || RewindSeconds <= 0.0f)
+    {
+        return World->LineTraceSingleByChannel(Hit, Start, End,
+            ECC_Telekinetic, QueryParams);
+    }
+
+    const float Time = World->GetTimeSeconds() - RewindSeconds;
+    const int32 Offset = FindFrameOffsetAtOrBefore(Time);
+    const FTDRewindFrame& Older = GetFrame(Offset);
+    const FTDRewindFrame* Newer = Offset > 0 ? &GetFrame(Offset - 1) : nullptr;
+    const float Alpha = Newer != nullptr && Newer->Time > Older.Time
+                            ? FMath::Clamp((Time - Older.Time) /
+                                  (Newer->Time - Older.Time), 0.0f, 1.0f)
+                            : 0.0f;
+
+    // Everything that isn't recorded is traced as it is now.
+    for (const FTDRewindSample& Sample : Older.Samples)
+    {
+        QueryParams.AddIgnoredActor(Sample.Actor.Get());
+    }
+    World->LineTraceSingleByChannel(Hit, Start, End, ECC_Telekinetic,
+        QueryParams);
+    float NearestDistance = Hit.bBlockingHit ? Hit.Distance : MAX_flt;
+
+    const FCollisionQueryParams ComponentQueryParams(
+        SCENE_QUERY_STAT(TelekineticRewind), true);
+    for (int32 i = 0; i < Older.Samples.Num(); ++i)
+    {
+        const FTDRewindSample& Sample = Older.Samples[i];
+        AActor* Actor = Sample.Actor.Get();
+        if (Actor == nullptr || Actor == IgnoredActor)
+        {
+            continue;
+        }
+
+        // Samples are only interpolated when the actor is at the same index in
+        // both frames, which it is unless orbs were added or removed.
+        FVector Location = Sample.Location;
+        if (Newer != nullptr && Newer->Samples.IsValidIndex(i) &&
+            Newer->Samples[i].Actor == Sample.Actor)
+        {
+            Location = FMath::Lerp(Location, Newer->Samples[i].Location, Alpha);
+        }
+
+        // Broadphase: skips actors whose bounds the segment doesn't pass.
+        if (FMath::PointDistToSegmentSquared(Location, Start, End) >
+            FMath::Square(Sample.BoundsRadius))
+        {
+            continue;
+        }
+
+        // Narrowphase: traces the actor's collision with the segment shifted
+        // by how far the actor has moved since, instead of moving the actor.
+        // LineTraceComponent ignores whether the collision is enabled, so that
+        // is checked here, e.g. for characters eliminated since the sample.
+        UPrimitiveComponent* Primitive = Cast<UPrimitiveComponent>(
+            Actor->GetRootComponent());
+        if (Primitive == nullptr || !Primitive->IsQueryCollisionEnabled() ||
+            Primitive->GetCollisionResponseToChannel(ECC_Telekinetic) !=
+            ECR_Block)
+        {
+            continue;
+        }
+
+        const FVector Shift = Actor->GetActorLocation() - Location;
+        FHitResult CandidateHit;
+        if (Primitive->LineTraceComponent(CandidateHit, Start + Shift,
+                End + Shift, ComponentQueryParams) &&
+            CandidateHit.Distance < NearestDistance)
+        {
+            NearestDistance = CandidateHit.Distance;
+            Hit = CandidateHit;
+            Hit.bBlockingHit = true;
+            Hit.Actor = Actor;
+            Hit.Component = Primitive;
+            Hit.TraceStart = Start;
+            Hit.TraceEnd = End;
+        }
+    }
+    return Hit.bBlockingHit;
+}
+
+int32 UTDRewindHistory::FindFrameOffsetAtOrBefore(const float Time) const
+{
+    for (int32 Offset = 0; Offset < NumFrames; ++Offset)
+    {
+        if (GetFrame(Offset).Time <= Time)
+        {
+            return Offset;
+        }
+    }
+    return NumFrames - 1;
+}
+
+const FTDRewindFrame& UTDRewindHistory::GetFrame(const int32 Offset) const
+{
+    return Frames[(NewestFrame - Offset + Frames.Num()) % Frames.Num()];
+}
+
+#pragma endregion
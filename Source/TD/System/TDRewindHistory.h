@@ -0,0 +1,142 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TDRewindHistory.generated.h"
+
+class APlayerState;
+
+/**
+ * @brief Where an actor was at the end of a frame, and the radius of a sphere
+ * that bounds its collision.
+ */
+struct FTDRewindSample
+{
+    TWeakObjectPtr<AActor> Actor;
+    FVector Location = FVector::ZeroVector;
+    float BoundsRadius = 0.0f;
+};
+
+/**
+ * @brief The samples of every orb and character at the end of a frame.
+ */
+struct FTDRewindFrame
+{
+    float Time = 0.0f;
+    TArray<FTDRewindSample> Samples;
+};
+
+/**
+ * @brief Records where the orbs and characters were at the end of each frame on
+ * the server, so that a remote player's telekinetic trace can be tested
+ * against what they saw when they aimed: the world as it was half their round
+ * trip plus the interpolation delay ago.
+ *
+ * The history is a ring buffer of MaxFrames frames whose sample arrays are
+ * reused, so its memory is bounded by the frames times the actors. A rewound
+ * trace tests the segment against each sample's bounding sphere, then only
+ * traces the collision of the actors that it passes near, shifted back to
+ * their rewound locations.
+ */
+UCLASS(Config = Game, DefaultConfig)
+class TD_API UTDRewindHistory : public UWorldSubsystem,
+                                public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Gets the history of the object's world.
+     */
+    static UTDRewindHistory* Get(const UObject* WorldContextObject);
+
+#pragma region Tick
+
+public:
+    /**
+     * @brief Samples every orb and character into the next frame.
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    /**
+     * @brief Only records on servers.
+     */
+    virtual bool IsTickable() const override;
+
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+    virtual TStatId GetStatId() const override;
+
+#pragma endregion
+
+#pragma region Rewind
+
+public:
+    /**
+     * @brief Gets how far to rewind for the player's view: half their round
+     * trip plus the interpolation delay, at most MaxRewindSeconds.
+     */
+    float GetRewindSeconds(const APlayerState* PlayerState) const;
+
+    /**
+     * @brief Line traces for Telekinetic against the orbs and characters where
+     * they were RewindSeconds ago, and against everything else as it is now.
+     * @param Hit Out parameter for the nearest blocking hit. A rewound actor's
+     * hit points are moved along with it to where it is now, so that they're
+     * in the same place relative to it as where the player aimed.
+     * @param IgnoredActor The actor that's tracing.
+     * @return Whether there was a blocking hit.
+     */
+    bool LineTraceTelekinetic(FHitResult& Hit, const FVector& Start,
+        const FVector& End, const float RewindSeconds,
+        const AActor* IgnoredActor) const;
+
+protected:
+    /**
+     * @brief The furthest back a trace can be rewound, which caps how much a
+     * high ping is compensated for.
+     */
+    UPROPERTY(Config)
+    float MaxRewindSeconds = 0.25f;
+
+    /**
+     * @brief How far behind the latest replicated state clients show orbs and
+     * characters.
+     */
+    UPROPERTY(Config)
+    float InterpolationSeconds = 0.05f;
+
+    /**
+     * @brief The number of frames kept, which bounds the history's memory.
+     */
+    UPROPERTY(Config)
+    int32 MaxFrames = 32;
+
+private:
+    /**
+     * @brief Gets the offset of the newest frame at or before the time, or of
+     * the oldest frame if the history doesn't go back that far.
+     */
+    int32 FindFrameOffsetAtOrBefore(const float Time) const;
+
+    /**
+     * @brief Gets the frame that's the offset from the newest frame, where an
+     * offset of 0 is the newest.
+     */
+    const FTDRewindFrame& GetFrame(const int32 Offset) const;
+
+    TArray<FTDRewindFrame> Frames;
+
+    /**
+     * @brief The index of the newest frame in Frames.
+     */
+    int32 NewestFrame = INDEX_NONE;
+
+    int32 NumFrames = 0;
+
+#pragma endregion
+};
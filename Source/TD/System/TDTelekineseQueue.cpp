@@ -0,0 +1,157 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDTelekineseQueue.h"
+
+#include "GameConfiguration.h"
+#include "TDRewindHistory.h"
+#include "TDWorldRegistry.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "GameRules/GameRules.h"
+#include "Player/TDCharacter.h"
+
+UTDTelekineseQueue* UTDTelekineseQueue::Get(const UObject* WorldContextObject)
+{
+    const UWorld* const World = WorldContextObject != nullptr
+                                    ? WorldContextObject->GetWorld()
+                                    : nullptr;
+    return World != nullptr
+               ? World->GetSubsystem<UTDTelekineseQueue>()
+               : nullptr;
+}
+
+#pragma region Tick
+
+void UTDTelekineseQueue::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    const UTDRewindHistory* RewindHistory = UTDRewindHistory::Get(this);
+    if (RewindHistory == nullptr)
+    {
+        LogInvalidPointer("UTDTelekineseQueue", "Tick", "RewindHistory");
+        Requests.Reset();
+        return;
+    }
+
+    Requests.Sort([](const FTDTelekineseRequest& A,
+        const FTDTelekineseRequest& B)
+        {
+            if (A.AimTime != B.AimTime)
+            {
+                return A.AimTime < B.AimTime;
+            }
+            if (A.PlayerId != B.PlayerId)
+            {
+                return A.PlayerId < B.PlayerId;
+            }
+            return A.Sequence < B.Sequence;
+        });
+
+    // Traces every request before applying any of them.
+    const float Time = World->GetTimeSeconds();
+    Hits.Reset();
+    Hits.SetNum(Requests.Num());
+    for (int32 i = 0; i < Requests.Num(); ++i)
+    {
+        const FTDTelekineseRequest& Request = Requests[i];
+        if (Request.Character.IsValid())
+        {
+            RewindHistory->LineTraceTelekinetic(Hits[i], Request.Start,
+                Request.End, Time - Request.AimTime, Request.Character.Get());
+        }
+    }
+
+    const UTDWorldRegistry* Registry = UTDWorldRegistry::Get(this);
+    const AGameRules* GameRules = Registry != nullptr
+                                      ? Registry->GetGameRules()
+                                      : nullptr;
+    for (int32 i = 0; i < Requests.Num(); ++i)
+    {
+        const FTDTelekineseRequest& Request = Requests[i];
+        ATDCharacter* Character = Request.Character.Get();
+        ITelekinetic* Telekinetic = Cast<ITelekinetic>(Hits[i].GetActor());
+        bool WasApplied = false;
+        if (Character != nullptr && Telekinetic != nullptr &&
+            GameRules != nullptr)
+        {
+            switch (Request.Telekinese)
+            {
+            case ETelekinese::Push:
+                if (GameRules->CanPush(Character))
+                {
+                    Telekinetic->OnPushed(Character, Hits[i]);
+                    WasApplied = true;
+                }
+                break;
+            case ETelekinese::Pull:
+                if (GameRules->CanPull(Character))
+                {
+                    Telekinetic->OnPulled(Character, Hits[i]);
+                    WasApplied = true;
+                }
+                break;
+            }
+        }
+        Request.OnResolved.ExecuteIfBound(WasApplied);
+    }
+    Requests.Reset();
+}
+
+bool UTDTelekineseQueue::IsTickable() const
+{
+    return !IsTemplate() && Requests.Num() > 0;
+}
+
+UWorld* UTDTelekineseQueue::GetTickableGameObjectWorld() const
+{
+    return GetWorld();
+}
+
+TStatId UTDTelekineseQueue::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTDTelekineseQueue, STATGROUP_Tickables);
+}
+
+#pragma endregion
+
+#pragma region Requests
+
+void UTDTelekineseQueue::Enqueue(ATDCharacter* Character,
+    const ETelekinese Telekinese, const FVector& Start, const FVector& End,
+    const float RewindSeconds, const FTDTelekineseResolved& OnResolved)
+{
+    if (Character == nullptr)
+    {
+        LogInvalidPointer("UTDTelekineseQueue", "Enqueue", "Character");
+        return;
+    }
+
+    const APlayerState* PlayerState = Character->GetPlayerState();
+    FTDTelekineseRequest& Request = Requests.AddDefaulted_GetRef();
+    Request.Character = Character;
+    Request.Telekinese = Telekinese;
+    Request.Start = Start;
+    Request.End = End;
+    Request.AimTime = GetWorld()->GetTimeSeconds() - RewindSeconds;
+    Request.PlayerId = PlayerState != nullptr
+                           ? PlayerState->GetPlayerId()
+                           : INDEX_NONE;
+    Request.Sequence = Requests.Num() - 1;
+    Request.OnResolved = OnResolved;
+}
+
+bool UTDTelekineseQueue::HasPendingRequest(const ATDCharacter* Character,
+    const ETelekinese Telekinese) const
+{
+    for (const FTDTelekineseRequest& Request : Requests)
+    {
+        if (Request.Character.Get() == Character &&
+            Request.Telekinese == Telekinese)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+#pragma endregion
@@ -0,0 +1,112 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Telekinetic.h"
+#include "Tickable.h"
+#include "TDTelekineseQueue.generated.h"
+
+class ATDCharacter;
+
+/**
+ * @brief A remote player's push or pull, waiting to be traced.
+ */
+struct FTDTelekineseRequest
+{
+    TWeakObjectPtr<ATDCharacter> Character;
+    ETelekinese Telekinese = ETelekinese::Push;
+    FVector Start = FVector::ZeroVector;
+    FVector End = FVector::ZeroVector;
+
+    /**
+     * @brief The server time that the player aimed at. @see UTDRewindHistory
+     */
+    float AimTime = 0.0f;
+
+    int32 PlayerId = INDEX_NONE;
+
+    /**
+     * @brief The order that the request was queued in this frame.
+     */
+    int32 Sequence = 0;
+
+    FTDTelekineseResolved OnResolved;
+};
+
+/**
+ * @brief Collects remote players' pushes and pulls on the server and resolves
+ * them together once per frame, after every actor has ticked, instead of
+ * tracing each one mid-frame when its ability activates.
+ *
+ * The requests are sorted by when each player aimed, then by player ID, so the
+ * order doesn't depend on when their RPCs arrived. Every request is traced
+ * before any of them is applied, so that a push can't move an orb out of the
+ * way of a trace in the same frame, then they're applied in that order, which
+ * makes simultaneous pushes on the same orb deterministic. Before each one is
+ * applied, the game rules are checked again, since the player may have been
+ * eliminated or the round may have ended since it was queued.
+ */
+UCLASS()
+class TD_API UTDTelekineseQueue : public UWorldSubsystem,
+                                  public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Gets the queue of the object's world.
+     */
+    static UTDTelekineseQueue* Get(const UObject* WorldContextObject);
+
+#pragma region Tick
+
+public:
+    /**
+     * @brief Resolves the frame's requests.
+     */
+    virtual void Tick(float DeltaTime) override;
+
+    /**
+     * @brief Only ticks on servers while there are requests.
+     */
+    virtual bool IsTickable() const override;
+
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+    virtual TStatId GetStatId() const override;
+
+#pragma endregion
+
+#pragma region Requests
+
+public:
+    /**
+     * @brief Queues the player's push or pull along the segment, rewound by
+     * the seconds, to be resolved at the end of the frame.
+     * @param OnResolved Called with whether it hit, once it's been resolved.
+     */
+    void Enqueue(ATDCharacter* Character, const ETelekinese Telekinese,
+        const FVector& Start, const FVector& End, const float RewindSeconds,
+        const FTDTelekineseResolved& OnResolved);
+
+    /**
+     * @brief Gets whether the player has a push or pull of the kind waiting to
+     * be resolved. Its cooldown isn't applied until it has been, so another
+     * activation in the meantime is rejected. @see UTDGA::CanActivateAbility
+     */
+    bool HasPendingRequest(const ATDCharacter* Character,
+        const ETelekinese Telekinese) const;
+
+private:
+    TArray<FTDTelekineseRequest> Requests;
+
+    /**
+     * @brief The hit of each request, reused between frames.
+     */
+    TArray<FHitResult> Hits;
+
+#pragma endregion
+};
@@ -0,0 +1,202 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDTickGovernor.h"
+
+#include "TDEventBus.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameState/TDGameState.h"
+#include "Misc/App.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Current Tick Rate"), STAT_TDCurrentTickRate,
+    STATGROUP_TDTickGovernor);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Target Tick Rate"), STAT_TDTargetTickRate,
+    STATGROUP_TDTickGovernor);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Work (ms)"), STAT_TDFrameWork,
+    STATGROUP_TDTickGovernor);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Seconds Over Budget"),
+    STAT_TDSecondsOverBudget, STATGROUP_TDTickGovernor);
+
+UTDTickGovernor* UTDTickGovernor::Get(const UObject* WorldContextObject)
+{
+    const UWorld* const World = WorldContextObject != nullptr
+                                    ? WorldContextObject->GetWorld()
+                                    : nullptr;
+    return World != nullptr ? World->GetSubsystem<UTDTickGovernor>() : nullptr;
+}
+
+#pragma region Subsystem
+
+bool UTDTickGovernor::ShouldCreateSubsystem(UObject* Outer) const
+{
+    return IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void UTDTickGovernor::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    ATDGameState* GameState = InWorld.GetGameState<ATDGameState>();
+    if (GameState == nullptr)
+    {
+        // Not a TD map, e.g. the main menu, so there are no phases to follow.
+        return;
+    }
+
+    TDGameState = GameState;
+    IsInPlay = GameState->IsInPlay();
+    GameState->GetEventBus().Subscribe<FTDPhaseChangedEvent, UTDTickGovernor,
+        &UTDTickGovernor::HandlePhaseChanged>(this);
+}
+
+void UTDTickGovernor::Deinitialize()
+{
+    if (TDGameState.IsValid())
+    {
+        TDGameState->GetEventBus().UnsubscribeAll(this);
+    }
+    if (MaxTickRate > 0)
+    {
+        ApplyTickRate(MaxTickRate);
+    }
+    Super::Deinitialize();
+}
+
+void UTDTickGovernor::HandlePhaseChanged(const FTDPhaseChangedEvent& Event)
+{
+    IsInPlay = Event.MatchPhase == EMatchPhase::InProgress &&
+        (Event.RoundPhase == ERoundPhase::RoundInProgress ||
+            Event.RoundPhase == ERoundPhase::RoundInOvertime);
+}
+
+#pragma endregion
+
+#pragma region Tick
+
+void UTDTickGovernor::Tick(float DeltaTime)
+{
+    if (MaxTickRate <= 0)
+    {
+        MaxTickRate = GetWorld()->GetNetDriver()->NetServerMaxTickRate;
+        CurrentTickRate = MaxTickRate;
+    }
+
+    UpdateCurrentTickRate(DeltaTime);
+
+    SET_DWORD_STAT(STAT_TDCurrentTickRate, CurrentTickRate);
+    SET_DWORD_STAT(STAT_TDTargetTickRate, GetTargetTickRate());
+    SET_FLOAT_STAT(STAT_TDFrameWork, AverageFrameWorkSeconds * 1000.0f);
+    SET_FLOAT_STAT(STAT_TDSecondsOverBudget, SecondsOverBudget);
+}
+
+bool UTDTickGovernor::IsTickable() const
+{
+    const UWorld* World = GetWorld();
+    return !IsTemplate() && World != nullptr &&
+        World->GetNetDriver() != nullptr;
+}
+
+UWorld* UTDTickGovernor::GetTickableGameObjectWorld() const
+{
+    return GetWorld();
+}
+
+TStatId UTDTickGovernor::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTDTickGovernor,
+        STATGROUP_TDTickGovernor);
+}
+
+#pragma endregion
+
+#pragma region Rates
+
+int32 UTDTickGovernor::GetCurrentTickRate() const
+{
+    return CurrentTickRate;
+}
+
+int32 UTDTickGovernor::GetTargetTickRate() const
+{
+    const ATDGameState* GameState = TDGameState.Get();
+    if (GameState == nullptr || GameState->PlayerArray.Num() == 0)
+    {
+        return FMath::Clamp(IdleTickRate, 1, MaxTickRate);
+    }
+    return IsInPlay
+               ? MaxTickRate
+               : FMath::Clamp(NonPlayTickRate, 1, MaxTickRate);
+}
+
+float UTDTickGovernor::GetSecondsOverBudget() const
+{
+    return SecondsOverBudget;
+}
+
+void UTDTickGovernor::UpdateCurrentTickRate(const float DeltaTime)
+{
+    // The frame's time includes the engine loop's sleep until the next frame,
+    // which isn't work.
+    const float FrameWorkSeconds = FMath::Max(
+        static_cast<float>(FApp::GetDeltaTime() - FApp::GetIdleTime()), 0.0f);
+    AverageFrameWorkSeconds = FMath::Lerp(AverageFrameWorkSeconds,
+        FrameWorkSeconds, 0.1f);
+
+    const float BudgetSeconds = FrameBudgetFraction / CurrentTickRate;
+    if (FrameWorkSeconds > BudgetSeconds)
+    {
+        SecondsOverBudget += DeltaTime;
+    }
+
+    const int32 TargetTickRate = GetTargetTickRate();
+    if (TargetTickRate != LastTargetTickRate)
+    {
+        // Phase changes shouldn't wait for the rate to step there.
+        LastTargetTickRate = TargetTickRate;
+        CurrentTickRate = TargetTickRate;
+        SecondsSinceRateChange = 0.0f;
+        ApplyTickRate(CurrentTickRate);
+        return;
+    }
+
+    SecondsSinceRateChange += DeltaTime;
+    if (SecondsSinceRateChange < RateChangeIntervalSeconds)
+    {
+        return;
+    }
+
+    const int32 Step = FMath::Max(
+        FMath::RoundToInt(CurrentTickRate * RateStepFraction), 1);
+    int32 NewTickRate = CurrentTickRate;
+    if (AverageFrameWorkSeconds > BudgetSeconds)
+    {
+        const int32 FloorTickRate = FMath::Min(MinTickRate, TargetTickRate);
+        NewTickRate = FMath::Max(CurrentTickRate - Step, FloorTickRate);
+    }
+    // Only recovers if the frame would still be within budget at the new rate.
+    else if (AverageFrameWorkSeconds * (CurrentTickRate + Step) <
+        FrameBudgetFraction)
+    {
+        NewTickRate = FMath::Min(CurrentTickRate + Step, TargetTickRate);
+    }
+
+    if (NewTickRate != CurrentTickRate)
+    {
+        CurrentTickRate = NewTickRate;
+        SecondsSinceRateChange = 0.0f;
+        ApplyTickRate(CurrentTickRate);
+    }
+}
+
+void UTDTickGovernor::ApplyTickRate(const int32 TickRate) const
+{
+    UNetDriver* NetDriver = GetWorld() != nullptr
+                                ? GetWorld()->GetNetDriver()
+                                : nullptr;
+    if (NetDriver != nullptr)
+    {
+        NetDriver->NetServerMaxTickRate = TickRate;
+    }
+}
+
+#pragma endregion
@@ -0,0 +1,180 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "TDTickGovernor.generated.h"
+
+class ATDGameState;
+struct FTDPhaseChangedEvent;
+
+DECLARE_STATS_GROUP(TEXT("TD Tick Governor"), STATGROUP_TDTickGovernor,
+    STATCAT_Advanced);
+
+/**
+ * @brief Sets a dedicated server's tick rate from the match phase and its load,
+ * so that several server processes can share a host:
+ * - The configured ceiling (the net driver's NetServerMaxTickRate) while a
+ *   round or overtime is in play.
+ * - NonPlayTickRate for the rest of the match, e.g. between rounds.
+ * - IdleTickRate while no players are connected.
+ *
+ * If the frame's work (its time minus the time spent waiting for the next
+ * frame) takes longer than its share of the budget, the rate backs off a step
+ * at a time down to MinTickRate, then recovers towards the target once there's
+ * headroom again. Listen servers and clients aren't governed.
+ *
+ * Its rates and the time spent over budget are shown by "stat TDTickGovernor".
+ */
+UCLASS(Config = Game, DefaultConfig)
+class TD_API UTDTickGovernor : public UWorldSubsystem,
+                               public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Gets the governor of the object's world, or nullptr if it isn't
+     * a dedicated server's world.
+     */
+    static UTDTickGovernor* Get(const UObject* WorldContextObject);
+
+#pragma region Subsystem
+
+public:
+    /**
+     * @brief Only creates the governor on dedicated servers.
+     */
+    virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+    /**
+     * @brief Subscribes to the game state's phase changes.
+     */
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    /**
+     * @brief Unsubscribes from phase changes and restores the ceiling.
+     */
+    virtual void Deinitialize() override;
+
+#pragma endregion
+
+#pragma region Tick
+
+public:
+    virtual void Tick(float DeltaTime) override;
+
+    virtual bool IsTickable() const override;
+
+    virtual UWorld* GetTickableGameObjectWorld() const override;
+
+    virtual TStatId GetStatId() const override;
+
+#pragma endregion
+
+#pragma region Rates
+
+public:
+    /**
+     * @brief Gets the tick rate that the server is currently running at.
+     */
+    int32 GetCurrentTickRate() const;
+
+    /**
+     * @brief Gets the tick rate for the current phase and players, which the
+     * current rate returns to when the server isn't over budget.
+     */
+    int32 GetTargetTickRate() const;
+
+    /**
+     * @brief Gets the total seconds of frames whose work went over budget.
+     */
+    float GetSecondsOverBudget() const;
+
+protected:
+    /**
+     * @brief The tick rate between rounds and before and after the match.
+     */
+    UPROPERTY(Config)
+    int32 NonPlayTickRate = 15;
+
+    /**
+     * @brief The tick rate while no players are connected.
+     */
+    UPROPERTY(Config)
+    int32 IdleTickRate = 5;
+
+    /**
+     * @brief The lowest tick rate that backing off can go down to while a
+     * round is in play.
+     */
+    UPROPERTY(Config)
+    int32 MinTickRate = 20;
+
+    /**
+     * @brief The fraction of a frame at the current rate that its work can
+     * take before it's over budget, leaving the rest for other processes.
+     */
+    UPROPERTY(Config)
+    float FrameBudgetFraction = 0.8f;
+
+    /**
+     * @brief The fraction of the rate that is removed or added by each step
+     * of backing off or recovering.
+     */
+    UPROPERTY(Config)
+    float RateStepFraction = 0.1f;
+
+    /**
+     * @brief The minimum seconds between changes to the rate, so that the
+     * average frame time can settle at the new rate.
+     */
+    UPROPERTY(Config)
+    float RateChangeIntervalSeconds = 1.0f;
+
+private:
+    /**
+     * @brief Caches whether a round or overtime is in play.
+     */
+    void HandlePhaseChanged(const FTDPhaseChangedEvent& Event);
+
+    /**
+     * @brief Jumps to the target rate when it changes, otherwise moves the
+     * current rate a step towards the target, or away from it if the average
+     * frame is over budget.
+     */
+    void UpdateCurrentTickRate(const float DeltaTime);
+
+    /**
+     * @brief Sets the net driver's tick rate, which the engine loop sleeps to.
+     */
+    void ApplyTickRate(const int32 TickRate) const;
+
+    TWeakObjectPtr<ATDGameState> TDGameState;
+
+    /**
+     * @brief The net driver's configured tick rate, which is used as the
+     * ceiling. Read the first time the governor ticks.
+     */
+    int32 MaxTickRate = 0;
+
+    int32 CurrentTickRate = 0;
+
+    int32 LastTargetTickRate = 0;
+
+    bool IsInPlay = false;
+
+    /**
+     * @brief Exponential moving average of the frame's work.
+     */
+    float AverageFrameWorkSeconds = 0.0f;
+
+    float SecondsOverBudget = 0.0f;
+
+    float SecondsSinceRateChange = 0.0f;
+
+#pragma endregion
+};
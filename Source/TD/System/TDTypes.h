@@ -113,6 +113,104 @@ inline TArray<ETeamIndex> ConvertTeamsToIndices(const TArray<FTeam>& Teams)
     return TeamIndices;
 }
 
+/**
+ * @brief A timer that only needs to be replicated when it's started or paused.
+ * Instead of replicating the seconds left every frame, it stores the seconds
+ * on the timer at the time it was last started or paused along with the server
+ * time it was started at, so clients can compute the current time locally from
+ * the synchronized server clock. @see AGameStateBase::GetServerWorldTimeSeconds
+ */
+USTRUCT(BlueprintType)
+struct TD_API FReplicatedTimer
+{
+    GENERATED_BODY()
+
+    FReplicatedTimer()
+    {
+    }
+
+    FReplicatedTimer(const bool ShouldCountUp)
+    {
+        CountsUp = ShouldCountUp;
+    }
+
+    /**
+     * @brief The seconds on the timer when it was last started or paused.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    float Seconds = 0.0f;
+
+    /**
+     * @brief The server world time that the timer was last started at.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    float StartServerTime = 0.0f;
+
+    /**
+     * @brief Whether the timer is currently running.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    bool IsRunning = false;
+
+    /**
+     * @brief Whether the timer counts up instead of down.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    bool CountsUp = false;
+
+    /**
+     * @brief Stops the timer and sets it to the provided seconds.
+     */
+    void Reset(const float NewSeconds)
+    {
+        Seconds = NewSeconds;
+        IsRunning = false;
+    }
+
+    /**
+     * @brief Starts (or resumes) the timer from the provided server time.
+     */
+    void Start(const float ServerTime)
+    {
+        if (IsRunning)
+        {
+            return;
+        }
+        StartServerTime = ServerTime;
+        IsRunning = true;
+    }
+
+    /**
+     * @brief Pauses the timer at the provided server time.
+     */
+    void Pause(const float ServerTime)
+    {
+        if (!IsRunning)
+        {
+            return;
+        }
+        Seconds = GetSeconds(ServerTime);
+        IsRunning = false;
+    }
+
+    /**
+     * @brief Gets the seconds on the timer at the provided server time. Timers
+     * that count down stop at 0.
+     */
+    float GetSeconds(const float ServerTime) const
+    {
+        if (!IsRunning)
+        {
+            return Seconds;
+        }
+
+        const float SecondsPassed = ServerTime - StartServerTime;
+        return CountsUp
+                   ? Seconds + SecondsPassed
+                   : FMath::Max(Seconds - SecondsPassed, 0.0f);
+    }
+};
+
 /**
  * @brief Contains all of the settings regarding to gameplay that the player can
  * set.
@@ -151,3 +249,144 @@ struct TD_API FPlayerAudioSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Audio)
     float GameSFXVolume = 0.5f;
 };
+
+/**
+ * @brief The match states defined in MatchState as an enum so that they can be
+ * switched on and packed into a few bits.
+ */
+UENUM(BlueprintType)
+enum class EMatchPhase : uint8
+{
+    None,
+    EnteringMap,
+    WaitingToStart,
+    InProgress,
+    WaitingPostMatch,
+    LeavingMap,
+    Aborted,
+};
+
+/**
+ * @brief The round states defined in RoundState as an enum so that they can be
+ * switched on and packed into a few bits.
+ */
+UENUM(BlueprintType)
+enum class ERoundPhase : uint8
+{
+    None,
+    WaitingPreRound,
+    RoundInProgress,
+    RoundInOvertime,
+    WaitingPostRound,
+};
+
+ENUM_RANGE_BY_FIRST_AND_LAST(ERoundPhase, ERoundPhase::None,
+    ERoundPhase::WaitingPostRound);
+
+/**
+ * @brief The match and round phases packed together so that they replicate as
+ * a single word, along with the round number. Whether the game is in play is
+ * cached and only recomputed when a phase changes.
+ */
+USTRUCT()
+struct TD_API FMatchRoundState
+{
+    GENERATED_BODY()
+
+    /**
+     * @brief The current match phase.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    EMatchPhase MatchPhase = EMatchPhase::None;
+
+    /**
+     * @brief The current round phase.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    ERoundPhase RoundPhase = ERoundPhase::None;
+
+    /**
+     * @brief The number of rounds that have started this match.
+     */
+    UPROPERTY(VisibleInstanceOnly)
+    uint16 RoundNumber = 0;
+
+    /**
+     * @brief Whether the match is in progress and a round (or overtime) is
+     * being played. Not replicated; recomputed from the phases.
+     */
+    UPROPERTY(VisibleInstanceOnly, NotReplicated)
+    bool IsInPlay = false;
+
+    void SetMatchPhase(const EMatchPhase NewMatchPhase)
+    {
+        MatchPhase = NewMatchPhase;
+        UpdateIsInPlay();
+    }
+
+    void SetRoundPhase(const ERoundPhase NewRoundPhase)
+    {
+        RoundPhase = NewRoundPhase;
+        UpdateIsInPlay();
+    }
+
+    /**
+     * @brief Whether the round went into overtime.
+     */
+    bool IsInOvertime() const
+    {
+        return RoundPhase == ERoundPhase::RoundInOvertime;
+    }
+
+    /**
+     * @brief Packs both phases into 6 bits followed by the packed round
+     * number.
+     */
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+    {
+        uint8 Phases = static_cast<uint8>(MatchPhase) |
+                       static_cast<uint8>(RoundPhase) << PhaseBits;
+        Ar.SerializeBits(&Phases, PhaseBits * 2);
+        uint32 PackedRoundNumber = RoundNumber;
+        Ar.SerializeIntPacked(PackedRoundNumber);
+
+        if (Ar.IsLoading())
+        {
+            MatchPhase = static_cast<EMatchPhase>(Phases & PhaseMask);
+            RoundPhase = static_cast<ERoundPhase>(Phases >> PhaseBits &
+                                                  PhaseMask);
+            RoundNumber = static_cast<uint16>(PackedRoundNumber);
+            UpdateIsInPlay();
+        }
+        bOutSuccess = true;
+        return true;
+    }
+
+private:
+    static constexpr uint8 PhaseBits = 3;
+    static constexpr uint8 PhaseMask = (1 << PhaseBits) - 1;
+
+    void UpdateIsInPlay()
+    {
+        switch (RoundPhase)
+        {
+        case ERoundPhase::RoundInProgress:
+        case ERoundPhase::RoundInOvertime:
+            IsInPlay = MatchPhase == EMatchPhase::InProgress;
+            break;
+        default:
+            IsInPlay = false;
+            break;
+        }
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FMatchRoundState> : public
+    TStructOpsTypeTraitsBase2<FMatchRoundState>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
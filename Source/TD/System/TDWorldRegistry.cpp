@@ -0,0 +1,136 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#include "TDWorldRegistry.h"
+
+#include "GameConfiguration.h"
+#include "Arena/OrbDisperser.h"
+#include "Arena/TeamPlayerStart.h"
+#include "Engine/World.h"
+#include "GameRules/GameRules.h"
+#include "Orb/Orb.h"
+#include "Player/TDCharacter.h"
+
+UTDWorldRegistry* UTDWorldRegistry::Get(const UObject* WorldContextObject)
+{
+    const UWorld* const World = WorldContextObject != nullptr
+                                    ? WorldContextObject->GetWorld()
+                                    : nullptr;
+    return World != nullptr ? World->GetSubsystem<UTDWorldRegistry>() : nullptr;
+}
+
+#pragma region Registration
+
+void UTDWorldRegistry::LogMissingRegistry(const UObject* Actor)
+{
+    LogInvalidPointer(Actor != nullptr ? Actor->GetClass()->GetName() : "",
+        "RegisterInWorld", "Registry");
+}
+
+template <typename ActorType>
+void UTDWorldRegistry::AddActor(TArray<ActorType*>& Actors, ActorType* Actor)
+{
+    if (Actor != nullptr && !SlotIndices.Contains(Actor))
+    {
+        SlotIndices.Add(Actor, Actors.Add(Actor));
+    }
+}
+
+template <typename ActorType>
+void UTDWorldRegistry::RemoveActor(TArray<ActorType*>& Actors,
+    ActorType* Actor)
+{
+    int32 Index;
+    if (!SlotIndices.RemoveAndCopyValue(Actor, Index))
+    {
+        return;
+    }
+    Actors.RemoveAtSwap(Index, 1, false);
+    if (Actors.IsValidIndex(Index))
+    {
+        SlotIndices[Actors[Index]] = Index;
+    }
+}
+
+void UTDWorldRegistry::Register(AGameRules* Actor)
+{
+    GameRules = Actor;
+}
+
+void UTDWorldRegistry::Unregister(AGameRules* Actor)
+{
+    if (GameRules == Actor)
+    {
+        GameRules = nullptr;
+    }
+}
+
+void UTDWorldRegistry::Register(AOrb* Actor)
+{
+    AddActor(Orbs, Actor);
+}
+
+void UTDWorldRegistry::Unregister(AOrb* Actor)
+{
+    RemoveActor(Orbs, Actor);
+}
+
+void UTDWorldRegistry::Register(AOrbDisperser* Actor)
+{
+    AddActor(OrbDispersers, Actor);
+}
+
+void UTDWorldRegistry::Unregister(AOrbDisperser* Actor)
+{
+    RemoveActor(OrbDispersers, Actor);
+}
+
+void UTDWorldRegistry::Register(ATDCharacter* Actor)
+{
+    AddActor(Characters, Actor);
+}
+
+void UTDWorldRegistry::Unregister(ATDCharacter* Actor)
+{
+    RemoveActor(Characters, Actor);
+}
+
+void UTDWorldRegistry::Register(ATeamPlayerStart* Actor)
+{
+    AddActor(TeamPlayerStarts, Actor);
+}
+
+void UTDWorldRegistry::Unregister(ATeamPlayerStart* Actor)
+{
+    RemoveActor(TeamPlayerStarts, Actor);
+}
+
+#pragma endregion
+
+#pragma region Lookups
+
+AGameRules* UTDWorldRegistry::GetGameRules() const
+{
+    return GameRules;
+}
+
+const TArray<AOrb*>& UTDWorldRegistry::GetOrbs() const
+{
+    return Orbs;
+}
+
+const TArray<AOrbDisperser*>& UTDWorldRegistry::GetOrbDispersers() const
+{
+    return OrbDispersers;
+}
+
+const TArray<ATDCharacter*>& UTDWorldRegistry::GetCharacters() const
+{
+    return Characters;
+}
+
+const TArray<ATeamPlayerStart*>& UTDWorldRegistry::GetTeamPlayerStarts() const
+{
+    return TeamPlayerStarts;
+}
+
+#pragma endregion
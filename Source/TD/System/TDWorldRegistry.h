@@ -0,0 +1,143 @@
+// Copyright 2021, James S. Wang, All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Subsystems/WorldSubsystem.h"
+#include "TDWorldRegistry.generated.h"
+
+class AGameRules;
+class AOrb;
+class AOrbDisperser;
+class ATDCharacter;
+class ATeamPlayerStart;
+
+/**
+ * @brief Keeps track of the TD actors that other classes need to find, so they
+ * don't have to iterate over every actor in the world. Actors register
+ * themselves in PostInitializeComponents and unregister in EndPlay.
+ *
+ * Each actor's index in its array is kept in a map, so registering and
+ * unregistering are constant time. Unregistering moves the last actor of the
+ * array into the removed actor's slot.
+ */
+UCLASS()
+class TD_API UTDWorldRegistry : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Gets the registry of the object's world.
+     */
+    static UTDWorldRegistry* Get(const UObject* WorldContextObject);
+
+#pragma region Registration
+
+public:
+    /**
+     * @brief Registers the actor with the registry of its world, or logs if
+     * there isn't one. Call from PostInitializeComponents.
+     */
+    template <typename ActorType>
+    static void RegisterInWorld(ActorType* Actor)
+    {
+        UTDWorldRegistry* Registry = Get(Actor);
+        if (Registry == nullptr)
+        {
+            LogMissingRegistry(Actor);
+            return;
+        }
+        Registry->Register(Actor);
+    }
+
+    /**
+     * @brief Unregisters the actor from the registry of its world, if there
+     * is one. Call from EndPlay.
+     */
+    template <typename ActorType>
+    static void UnregisterFromWorld(ActorType* Actor)
+    {
+        UTDWorldRegistry* Registry = Get(Actor);
+        if (Registry != nullptr)
+        {
+            Registry->Unregister(Actor);
+        }
+    }
+
+    void Register(AGameRules* Actor);
+    void Unregister(AGameRules* Actor);
+    void Register(AOrb* Actor);
+    void Unregister(AOrb* Actor);
+    void Register(AOrbDisperser* Actor);
+    void Unregister(AOrbDisperser* Actor);
+    void Register(ATDCharacter* Actor);
+    void Unregister(ATDCharacter* Actor);
+    void Register(ATeamPlayerStart* Actor);
+    void Unregister(ATeamPlayerStart* Actor);
+
+private:
+    static void LogMissingRegistry(const UObject* Actor);
+
+    template <typename ActorType>
+    void AddActor(TArray<ActorType*>& Actors, ActorType* Actor);
+
+    template <typename ActorType>
+    void RemoveActor(TArray<ActorType*>& Actors, ActorType* Actor);
+
+    /**
+     * @brief The index of each registered actor in its array.
+     */
+    TMap<const UObject*, int32> SlotIndices;
+
+#pragma endregion
+
+#pragma region Lookups
+
+public:
+    /**
+     * @brief Gets the game rules, or nullptr if they haven't been spawned (or
+     * replicated) yet.
+     */
+    AGameRules* GetGameRules() const;
+
+    /**
+     * @brief Gets all orbs, in no particular order. Copy the array before
+     * destroying orbs while iterating over it.
+     */
+    const TArray<AOrb*>& GetOrbs() const;
+
+    /**
+     * @brief Gets all orb dispersers, in no particular order.
+     */
+    const TArray<AOrbDisperser*>& GetOrbDispersers() const;
+
+    /**
+     * @brief Gets all player characters, in no particular order.
+     */
+    const TArray<ATDCharacter*>& GetCharacters() const;
+
+    /**
+     * @brief Gets all team player starts, in no particular order.
+     */
+    const TArray<ATeamPlayerStart*>& GetTeamPlayerStarts() const;
+
+private:
+    UPROPERTY()
+    AGameRules* GameRules = nullptr;
+
+    UPROPERTY()
+    TArray<AOrb*> Orbs;
+
+    UPROPERTY()
+    TArray<AOrbDisperser*> OrbDispersers;
+
+    UPROPERTY()
+    TArray<ATDCharacter*> Characters;
+
+    UPROPERTY()
+    TArray<ATeamPlayerStart*> TeamPlayerStarts;
+
+#pragma endregion
+};
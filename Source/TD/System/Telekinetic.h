@@ -8,6 +8,35 @@
 
 class ATDCharacter;
 
+/**
+ * @brief The kinds of telekinese.
+ */
+enum class ETelekinese : uint8
+{
+    Push,
+    Pull,
+};
+
+/**
+ * @brief The outcome of a player's attempt to telekinese.
+ */
+enum class ETelekineseResult : uint8
+{
+    Missed,
+    Hit,
+
+    /**
+     * @brief Queued on the server, which resolves it at the end of the frame.
+     * @see UTDTelekineseQueue
+     */
+    Queued,
+};
+
+/**
+ * @brief Called with whether a queued telekinese hit.
+ */
+DECLARE_DELEGATE_OneParam(FTDTelekineseResolved, bool);
+
 // This class does not need to be modified.
 UINTERFACE(MinimalAPI)
 class UTelekinetic : public UInterface
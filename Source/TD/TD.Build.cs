@@ -8,8 +8,8 @@ public class TD : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore" });
-		PrivateDependencyModuleNames.AddRange(new string[] { "UMG", "OnlineSubsystem", "OnlineSubsystemNull", "OnlineSubsystemSteam", "PhysicsCore", "GameplayAbilities", "GameplayTags", "GameplayTasks" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "NetCore" });
+		PrivateDependencyModuleNames.AddRange(new string[] { "UMG", "OnlineSubsystem", "OnlineSubsystemNull", "OnlineSubsystemSteam", "PhysicsCore", "GameplayAbilities", "GameplayTags", "GameplayTasks", "ReplicationGraph" });
 
 		PrivateIncludePaths.AddRange(new string[] { "TD", "TD/System" });
 	}
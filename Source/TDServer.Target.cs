@@ -10,5 +10,8 @@ public class TDServerTarget : TargetRules
 		Type = TargetType.Server;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
 		ExtraModuleNames.AddRange( new string[] { "TD" } );
+
+		// Lets push based properties skip comparisons until they're marked dirty.
+		bWithPushModel = true;
 	}
 }